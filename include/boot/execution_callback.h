@@ -128,4 +128,26 @@ class StatisticExecutionCallback final : public io::ExecutionCallback
   private:
     statistic::SystemStatistics &_system_statistics;
 };
+
+class ColumnStatisticExecutionCallback final : public io::ExecutionCallback
+{
+  public:
+    explicit ColumnStatisticExecutionCallback(statistic::SystemStatistics &system_statistics)
+        : _system_statistics(system_statistics)
+    {
+    }
+    ~ColumnStatisticExecutionCallback() override = default;
+
+    void on_schema(const table::Schema &) override
+    {
+    }
+    void on_tuple(const table::Tuple &tuple) override;
+
+    void on_plan(const std::unique_ptr<plan::logical::NodeInterface> &) override
+    {
+    }
+
+  private:
+    statistic::SystemStatistics &_system_statistics;
+};
 } // namespace beedb::boot
\ No newline at end of file
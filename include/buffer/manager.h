@@ -26,8 +26,10 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <recovery/log_manager.h>
 #include <storage/manager.h>
 #include <storage/page.h>
+#include <utility>
 #include <vector>
 
 namespace beedb::buffer
@@ -41,11 +43,26 @@ namespace beedb::buffer
  * through the BufferManager. When the page is not needed any more
  * (e.g. all tuples are scanned), the page can be unpinned by the
  * BufferManager.
+ *
+ * Dirty pages are not forced to disk when a transaction commits; they
+ * are written back lazily on eviction. Before a page is written back,
+ * the log is flushed up to the LSN of the page (write-ahead logging).
  */
 class Manager
 {
   public:
-    Manager(std::size_t count_frames, storage::Manager &space_manager,
+    /**
+     * Pins of a single thread, split into buffer hits (the page
+     * was buffered) and misses (the page was read from disk).
+     */
+    struct AccessStatistics
+    {
+        std::uint64_t count_pins = 0u;
+        std::uint64_t count_hits = 0u;
+        std::uint64_t count_misses = 0u;
+    };
+
+    Manager(std::size_t count_frames, storage::Manager &space_manager, recovery::LogManager &log_manager,
             std::unique_ptr<ReplacementStrategy> &&replacement_strategy = nullptr);
     ~Manager();
 
@@ -104,6 +121,28 @@ class Manager
         _replacement_strategy = std::move(replacement_strategy);
     }
 
+    /**
+     * Writes the (pinned) page to disk immediately, for changes that
+     * can not be redone from the log, like links between pages.
+     *
+     * @param page Page to write.
+     */
+    void write_through(storage::Page *page);
+
+    /**
+     * Writes unpinned dirty pages back to disk, whose first change not
+     * on disk is older than the given LSN. Used by checkpoints to bound
+     * the part of the log that has to be redone after a crash.
+     *
+     * @param recovery_lsn LSN; dirty pages changed before are written.
+     */
+    void write_back_dirty_pages(std::uint64_t recovery_lsn);
+
+    /**
+     * @return Ids of dirty pages together with the LSN of their first change not on disk.
+     */
+    [[nodiscard]] std::vector<std::pair<storage::Page::id_t, std::uint64_t>> dirty_pages();
+
     /**
      * @return Number of evicted frames.
      */
@@ -112,8 +151,19 @@ class Manager
         return _evicted_frames;
     }
 
+    /**
+     * @return Pins of the calling thread, e.g., to attribute pins to the running query.
+     */
+    [[nodiscard]] static const AccessStatistics &access_statistics()
+    {
+        return _access_statistics;
+    }
+
   private:
+    static thread_local AccessStatistics _access_statistics;
+
     storage::Manager &_space_manager;
+    recovery::LogManager &_log_manager;
     std::unique_ptr<ReplacementStrategy> _replacement_strategy;
 
     std::vector<storage::Page> _frames;
@@ -127,6 +177,15 @@ class Manager
      */
     void flush();
 
+    /**
+     * Writes a single page back to disk, after the log
+     * describing the changes on the page is durable.
+     * The page is clean afterwards.
+     *
+     * @param page Page to write back.
+     */
+    void write_back(storage::Page &page);
+
     /**
      * Lookup for frame information for a specific page.
      * The frame information stores information like pin
@@ -23,12 +23,17 @@
 #pragma once
 #include "metadata.h"
 #include "timestamp.h"
+#include "write_set_summary.h"
+#include <execution/cancellation.h>
 #include <execution/predicate_matcher.h>
 #include <functional>
+#include <index/index_interface.h>
+#include <memory>
 #include <optional>
 #include <storage/record_page.h>
 #include <table/table.h>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace beedb::concurrency
@@ -40,9 +45,10 @@ namespace beedb::concurrency
 enum IsolationLevel : std::uint8_t
 {
     Serializable = 0,
-    // RepeatableRead = 1,
-    // ReadCommitted = 2,
-    // ReadUncommitted = 3
+    Snapshot = 1,
+    // RepeatableRead = 2,
+    // ReadCommitted = 3,
+    // ReadUncommitted = 4
 };
 
 /**
@@ -68,7 +74,7 @@ class ReadSetItem
      */
     [[nodiscard]] storage::RecordIdentifier in_place_record_identifier() const
     {
-        return _read_record_identifier;
+        return _in_place_record_identifier;
     }
 
     /**
@@ -247,15 +253,73 @@ class WriteSetItem
     storage::Page::offset_t _written_size;
 };
 
+/**
+ * An index write set item records a (key,page) pair a transaction added to
+ * or removed from an index. Indices are not versioned; an abort restores
+ * the index by undoing the items in reverse order.
+ */
+class IndexWriteSetItem
+{
+  public:
+    enum ModificationType
+    {
+        Inserted,
+        Removed
+    };
+
+    IndexWriteSetItem(std::shared_ptr<index::IndexInterface> index, const std::int64_t key,
+                      const storage::Page::id_t page_id, const ModificationType modification_type)
+        : _index(std::move(index)), _key(key), _page_id(page_id), _type(modification_type)
+    {
+    }
+
+    IndexWriteSetItem(IndexWriteSetItem &&) = default;
+
+    ~IndexWriteSetItem() = default;
+
+    /**
+     * Restores the index as it was before the modification.
+     */
+    void undo() const
+    {
+        if (_type == ModificationType::Inserted)
+        {
+            _index->remove(_key, _page_id);
+        }
+        else
+        {
+            _index->put(_key, _page_id);
+        }
+    }
+
+  private:
+    // Modified index.
+    std::shared_ptr<index::IndexInterface> _index;
+
+    // Key of the modified pair.
+    std::int64_t _key;
+
+    // Page of the modified pair.
+    storage::Page::id_t _page_id;
+
+    // Type of the modification.
+    ModificationType _type;
+};
+
 /**
  * The transaction stores the begin and commit timestamp of the transaction,
  * as well as the read and write set.
+ * Read-only transactions read the snapshot of their begin timestamp; they
+ * track neither read nor scan set and commit without validation.
+ * Under snapshot isolation, only the written records are validated
+ * (first committer wins); reads are not tracked either.
  */
 class Transaction
 {
   public:
-    explicit Transaction(const IsolationLevel isolation_level, const timestamp begin)
-        : _isolation_level(isolation_level), _begin_timestamp(begin), _commit_timestamp(timestamp::make_infinity())
+    explicit Transaction(const IsolationLevel isolation_level, const timestamp begin, const bool is_read_only = false)
+        : _isolation_level(isolation_level), _is_read_only(is_read_only), _begin_timestamp(begin),
+          _commit_timestamp(timestamp::make_infinity())
     {
     }
 
@@ -264,11 +328,62 @@ class Transaction
     /**
      * @return Isolation level of this transaction.
      */
-    [[maybe_unused]] [[nodiscard]] IsolationLevel isolation_level() const
+    [[nodiscard]] IsolationLevel isolation_level() const
     {
         return _isolation_level;
     }
 
+    /**
+     * @return True, when this transaction does not write.
+     */
+    [[nodiscard]] bool is_read_only() const
+    {
+        return _is_read_only;
+    }
+
+    /**
+     * @return True, when the reads of this transaction are validated on commit
+     *         and read and scan set have to be tracked.
+     */
+    [[nodiscard]] bool is_validating_reads() const
+    {
+        return _is_read_only == false && _isolation_level == IsolationLevel::Serializable;
+    }
+
+    /**
+     * Adds a reference to this transaction; guarded by the transaction manager.
+     */
+    void reference() noexcept
+    {
+        ++_count_references;
+    }
+
+    /**
+     * Removes a reference from this transaction; guarded by the transaction manager.
+     * @return True, when the transaction is not referenced anymore and can be deleted.
+     */
+    [[nodiscard]] bool dereference() noexcept
+    {
+        return --_count_references == 0u;
+    }
+
+    /**
+     * @return True, when this transaction was aborted.
+     */
+    [[nodiscard]] bool is_aborted() const
+    {
+        return _is_aborted;
+    }
+
+    /**
+     * Marks this transaction as aborted.
+     * @param is_aborted True, when the transaction was aborted.
+     */
+    void is_aborted(const bool is_aborted)
+    {
+        _is_aborted = is_aborted;
+    }
+
     /**
      * Update the commit timestamp of this transaction.
      * @param commit_timestamp Timestamp this transaction commits.
@@ -312,6 +427,57 @@ class Transaction
         _write_set.emplace_back(std::move(write_set_item));
     }
 
+    /**
+     * Adds an item to the index write set.
+     * @param index_write_set_item Index modification of this transaction.
+     */
+    void add_to_index_write_set(IndexWriteSetItem &&index_write_set_item)
+    {
+        _index_write_set.emplace_back(std::move(index_write_set_item));
+    }
+
+    /**
+     * Registers an action that runs once the transaction committed,
+     * e.g., to publish in-memory state derived from the written data.
+     * Aborted transactions drop their actions.
+     * @param action Action to run on commit.
+     */
+    void on_commit(std::function<void()> &&action)
+    {
+        _commit_actions.emplace_back(std::move(action));
+    }
+
+    /**
+     * Registers an action that runs once no transaction can see the versions replaced
+     * by this committed transaction anymore, e.g., to remove index entries of replaced keys.
+     * Aborted transactions drop their actions.
+     * @param action Action to run, getting the begin time of the oldest running transaction.
+     */
+    void on_reclaim(std::function<void(timestamp::timestamp_t)> &&action)
+    {
+        _reclaim_actions.emplace_back(std::move(action));
+    }
+
+    /**
+     * Hands the actions registered for reclaiming the replaced versions over to the caller.
+     * @return Actions to run.
+     */
+    [[nodiscard]] std::vector<std::function<void(timestamp::timestamp_t)>> take_reclaim_actions()
+    {
+        return std::exchange(_reclaim_actions, {});
+    }
+
+    /**
+     * Runs the actions registered for the commit.
+     */
+    void committed() const
+    {
+        for (const auto &action : _commit_actions)
+        {
+            action();
+        }
+    }
+
     /**
      * Adds an item to the scan set.
      * @param scan_set_item Item that was scanned by this transaction.
@@ -337,6 +503,14 @@ class Transaction
         return _write_set;
     }
 
+    /**
+     * @return Index write set of this transaction.
+     */
+    [[nodiscard]] const std::vector<IndexWriteSetItem> &index_write_set() const
+    {
+        return _index_write_set;
+    }
+
     /**
      * @return Scan set of this transaction.
      */
@@ -345,23 +519,75 @@ class Transaction
         return _scan_set;
     }
 
+    /**
+     * @return Summary of the write set, built on commit.
+     */
+    [[nodiscard]] WriteSetSummary &write_set_summary()
+    {
+        return _write_set_summary;
+    }
+
+    /**
+     * Set the cancellation of the running statement.
+     * @param cancellation Cancellation, checked by operators; nullptr when no statement runs.
+     */
+    void cancellation(const execution::Cancellation *cancellation)
+    {
+        _cancellation = cancellation;
+    }
+
+    /**
+     * Throws, when the running statement was cancelled.
+     */
+    void check_cancellation() const
+    {
+        if (_cancellation != nullptr)
+        {
+            _cancellation->check();
+        }
+    }
+
   private:
     // Isolation level of the transaction.
     const IsolationLevel _isolation_level;
 
+    // Read-only transactions skip read and scan set tracking.
+    const bool _is_read_only;
+
     // Timestamp this transaction was created.
     const timestamp _begin_timestamp;
 
     // Timestamp this transaction committed.
     timestamp _commit_timestamp;
 
+    // True, once the writes of this transaction were undone.
+    bool _is_aborted = false;
+
+    // References by the owner (until released) and the commit history (until reclaimed).
+    std::uint32_t _count_references = 1u;
+
     // Items that were read by this transaction.
     std::vector<ReadSetItem> _read_set;
 
     // Items that were written by this transaction.
     std::vector<WriteSetItem> _write_set;
 
+    // Index modifications of this transaction, undone on abort.
+    std::vector<IndexWriteSetItem> _index_write_set;
+
     // Items that were scanned by this transaction.
     std::vector<ScanSetItem *> _scan_set;
+
+    // Actions that run once this transaction committed.
+    std::vector<std::function<void()>> _commit_actions;
+
+    // Actions run when the versions replaced by this transaction are not visible anymore.
+    std::vector<std::function<void(timestamp::timestamp_t)>> _reclaim_actions;
+
+    // Summary of the written records for validating concurrent transactions.
+    WriteSetSummary _write_set_summary;
+
+    // Cancellation of the running statement.
+    const execution::Cancellation *_cancellation = nullptr;
 };
 } // namespace beedb::concurrency
\ No newline at end of file
@@ -26,28 +26,46 @@
 #include <array>
 #include <atomic>
 #include <buffer/manager.h>
+#include <deque>
+#include <mutex>
+#include <recovery/log_manager.h>
+#include <set>
 #include <shared_mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace beedb::concurrency
 {
 /**
  * The TransactionManager creates new transactions and performs
  * commit and abort of those transactions.
+ * Committed and reverted writes are logged to the write-ahead log;
+ * a commit returns after its commit record is durable.
+ *
+ * Committed transactions are kept in a commit-ordered history for the
+ * validation of concurrent transactions. Entries that committed before
+ * the oldest active transaction began can not conflict with any running
+ * transaction anymore and are reclaimed epoch-wise: They are retired first
+ * and deleted once all transactions active at retirement have ended.
+ * The creator of a transaction owns it until releasing it; a transaction
+ * is deleted when it was released and is not part of the history anymore.
  */
 class TransactionManager
 {
   public:
-    explicit TransactionManager(buffer::Manager &buffer_manager);
+    TransactionManager(buffer::Manager &buffer_manager, recovery::LogManager &log_manager);
     ~TransactionManager();
 
     /**
      * Creates a new transaction with the given isolation level.
      *
      * @param isolation_level Isolation level.
+     * @param is_read_only True, when the transaction will not write.
      * @return New transaction.
      */
-    Transaction *new_transaction(const IsolationLevel isolation_level = IsolationLevel::Serializable);
+    Transaction *new_transaction(const IsolationLevel isolation_level = IsolationLevel::Serializable,
+                                 const bool is_read_only = false);
 
     /**
      * Aborts the given transaction and reverts all
@@ -65,6 +83,14 @@ class TransactionManager
      */
     bool commit(Transaction &transaction);
 
+    /**
+     * Releases a committed or aborted transaction by its owner, which must not
+     * use it afterwards. The transaction is deleted, when the history does not
+     * reference it anymore.
+     * @param transaction Transaction to release.
+     */
+    void release(Transaction *transaction);
+
     /**
      * Tests if a given timestamp range is visible for the given transaction.
      * @param transaction Transaction to test.
@@ -104,18 +130,110 @@ class TransactionManager
     }
 
   private:
+    /**
+     * Keeps the most recently accessed page pinned, so that
+     * consecutive writes to the same page pin it only once.
+     * Pages are unpinned as dirty.
+     */
+    class PinnedPage
+    {
+      public:
+        explicit PinnedPage(buffer::Manager &buffer_manager) : _buffer_manager(buffer_manager)
+        {
+        }
+        ~PinnedPage() = default;
+
+        /**
+         * Pins the page, unless it is already pinned; the page pinned before is unpinned.
+         * @param page_id Id of the page.
+         * @return Pinned page.
+         */
+        storage::RecordPage *get(storage::Page::id_t page_id);
+
+        /**
+         * Unpins the pinned page, if any.
+         */
+        void release();
+
+      private:
+        buffer::Manager &_buffer_manager;
+        storage::RecordPage *_page = nullptr;
+    };
+
     // Buffer manager to read/write to pages.
     buffer::Manager &_buffer_manager;
 
+    // Write-ahead log for committed writes.
+    recovery::LogManager &_log_manager;
+
     // Timestamp for the next transaction.
     std::atomic<timestamp::timestamp_t> _next_timestamp{2u};
 
-    // Map of Timestamp => Transaction of only committed transactions.
-    std::unordered_map<timestamp::timestamp_t, Transaction *> _commit_history;
+    // Begin timestamps of all running transactions.
+    std::set<timestamp::timestamp_t> _active_transactions;
+
+    // Latch for the active transactions and the timestamp handed out on begin.
+    std::mutex _active_transactions_latch;
+
+    // Committed transactions (commit time, transaction), ordered by commit time.
+    std::deque<std::pair<timestamp::timestamp_t, Transaction *>> _commit_history;
 
-    // Latch for the history map.
+    // Transactions removed from the history (retirement epoch, transaction),
+    // waiting for all transactions active at retirement to end.
+    std::deque<std::pair<timestamp::timestamp_t, Transaction *>> _retired_transactions;
+
+    // Latch for the history and the retired transactions.
     std::shared_mutex _commit_history_latch;
 
+    /**
+     * Removes a transaction from the set of running transactions.
+     * @param transaction Transaction that ended.
+     */
+    void end(const Transaction &transaction);
+
+    /**
+     * @return Begin timestamp of the oldest running transaction or the
+     *         next timestamp, when no transaction is running.
+     */
+    timestamp::timestamp_t oldest_active_timestamp();
+
+    /**
+     * Retires history entries no running transaction can conflict with
+     * and deletes retired transactions whose epoch has passed.
+     */
+    void collect_garbage();
+
+    /**
+     * Appends the after-image of a committed record to the log
+     * and remembers the LSN on the page.
+     * @param transaction Committing transaction.
+     * @param page Pinned page holding the record.
+     * @param record_identifier Identifier of the record.
+     * @param image Committed image of the record, carrying the commit timestamp.
+     */
+    void log_write(const Transaction &transaction, storage::RecordPage *page,
+                   storage::RecordIdentifier record_identifier, const std::vector<std::byte> &image);
+
+    /**
+     * Lists the records written by a transaction ordered by their page, so that
+     * the write phase of commit and abort visits each page once. The in-place
+     * records come first, followed by the old versions of updated records.
+     * @param transaction Transaction.
+     * @return List of (record, write set item) pairs.
+     */
+    static std::vector<std::pair<storage::RecordIdentifier, const WriteSetItem *>> page_ordered_writes(
+        const Transaction &transaction);
+
+    /**
+     * Appends the image of a record restored by an abort to the log
+     * (or a freed slot) and remembers the LSN on the page.
+     * @param transaction Aborting transaction.
+     * @param page Pinned page holding the record.
+     * @param record_identifier Identifier of the record.
+     */
+    void log_compensation(const Transaction &transaction, storage::RecordPage *page,
+                          storage::RecordIdentifier record_identifier);
+
     /**
      * Validates a transaction to commit.
      * @param transaction Transaction to commit.
@@ -138,6 +256,18 @@ class TransactionManager
     static bool validate_write_skew_anomalies(Transaction &transaction,
                                               const std::vector<Transaction *> &concurrent_transactions);
 
+    /**
+     * Validates write-write conflicts for snapshot isolation. A transaction T
+     * can not commit, when a concurrent transaction T' committed a write
+     * to a record T updated or deleted.
+     * @param transaction Transaction to validate.
+     * @param concurrent_transactions List of transactions that committed between
+     *        the transactions started and committed.
+     * @return True, when the transaction is valid.
+     */
+    static bool validate_write_write_conflicts(Transaction &transaction,
+                                               const std::vector<Transaction *> &concurrent_transactions);
+
     /**
      * Validates the scan set of a transaction. A transaction T
      * may scan a table while a concurrent transaction inserts/deletes/updates
@@ -151,12 +281,14 @@ class TransactionManager
     bool validate_scan_set(Transaction &transaction, const std::vector<Transaction *> &concurrent_transactions);
 
     /**
-     * Validates a single scan of a transaction against the write sets of concurrent transactions.
+     * Validates a single scan of a transaction against the records
+     * a concurrent transaction wrote to the scanned table.
      * @param scan_set_item Single scan set.
-     * @param write_set List of write sets of concurrent transactions.
+     * @param written_images Images of the records written by a concurrent transaction.
      * @return True, when the scan set is valid.
      */
-    bool validate_scan_set_item(ScanSetItem *scan_set_item, const std::vector<WriteSetItem> &write_set);
+    static bool validate_scan_set_item(ScanSetItem *scan_set_item,
+                                       std::vector<WriteSetSummary::Image> &written_images);
 
     /**
      * Calculates the transactions that have committed between begin and end.
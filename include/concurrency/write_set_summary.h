@@ -0,0 +1,227 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include "metadata.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <storage/record_identifier.h>
+#include <table/table.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace beedb::concurrency
+{
+/**
+ * Compact summary of the write set of a committed transaction, built
+ * while the transaction writes its changes to the global state.
+ * Concurrent transactions validate against the summary instead of
+ * the write set: A Bloom filter over the written record identifiers
+ * rejects most records that were not written without touching the
+ * exact set; the images of the written records, grouped by table,
+ * allow re-evaluating scan predicates without pinning pages.
+ */
+class WriteSetSummary
+{
+  public:
+    /**
+     * Image of a written record (metadata followed by data) as
+     * it was at commit time.
+     */
+    class Image
+    {
+      public:
+        Image(const storage::RecordIdentifier record_identifier, const std::byte *record, const std::size_t size)
+            : _record_identifier(record_identifier), _record(record, record + size)
+        {
+        }
+        Image(Image &&) = default;
+        ~Image() = default;
+
+        /**
+         * @return Identifier of the record in the table space.
+         */
+        [[nodiscard]] storage::RecordIdentifier record_identifier() const
+        {
+            return _record_identifier;
+        }
+
+        /**
+         * @return Metadata of the record.
+         */
+        [[nodiscard]] Metadata *metadata()
+        {
+            return reinterpret_cast<Metadata *>(_record.data());
+        }
+
+        /**
+         * @return Data of the record, following the metadata.
+         */
+        [[nodiscard]] std::byte *data()
+        {
+            return _record.data() + sizeof(Metadata);
+        }
+
+      private:
+        // Identifier of the record in the table space.
+        storage::RecordIdentifier _record_identifier;
+
+        // Copy of the record.
+        std::vector<std::byte> _record;
+    };
+
+    WriteSetSummary() = default;
+    ~WriteSetSummary() = default;
+
+    /**
+     * Reserves space for the given number of written records
+     * and sizes the Bloom filter accordingly.
+     * @param count_records Number of written records.
+     */
+    void reserve(const std::size_t count_records)
+    {
+        std::size_t count_bits = 64u;
+        while (count_bits < count_records * bits_per_record)
+        {
+            count_bits <<= 1u;
+        }
+        _filter.assign(count_bits / 64u, 0u);
+        _record_identifiers.reserve(count_records);
+    }
+
+    /**
+     * Adds a written record to the summary.
+     * @param table_id Id of the table the record belongs to.
+     * @param record_identifier Identifier of the record in the table space.
+     * @param record Pointer to the record (metadata followed by data).
+     * @param size Size of the record including metadata.
+     */
+    void add(const table::Table::id_t table_id, const storage::RecordIdentifier record_identifier,
+             const std::byte *record, const std::size_t size)
+    {
+        if (_filter.empty())
+        {
+            this->reserve(1u);
+        }
+
+        const auto [first, second] = WriteSetSummary::hash(record_identifier);
+        for (auto i = 0u; i < count_hashes; ++i)
+        {
+            const auto bit = (first + i * second) & (_filter.size() * 64u - 1u);
+            _filter[bit / 64u] |= std::uint64_t(1u) << (bit % 64u);
+        }
+
+        _record_identifiers.emplace_back(static_cast<std::uint64_t>(record_identifier));
+        _images[table_id].emplace_back(record_identifier, record, size);
+    }
+
+    /**
+     * Sorts the written record identifiers for exact lookups.
+     * Has to be called before the summary is published.
+     */
+    void seal()
+    {
+        std::sort(_record_identifiers.begin(), _record_identifiers.end());
+    }
+
+    /**
+     * Tests if the record may have been written. False positives are possible.
+     * @param record_identifier Identifier of the record in the table space.
+     * @return False, when the record was definitely not written.
+     */
+    [[nodiscard]] bool may_contain(const storage::RecordIdentifier record_identifier) const
+    {
+        if (_filter.empty())
+        {
+            return false;
+        }
+
+        const auto [first, second] = WriteSetSummary::hash(record_identifier);
+        for (auto i = 0u; i < count_hashes; ++i)
+        {
+            const auto bit = (first + i * second) & (_filter.size() * 64u - 1u);
+            if ((_filter[bit / 64u] & (std::uint64_t(1u) << (bit % 64u))) == 0u)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Tests if the record was written.
+     * @param record_identifier Identifier of the record in the table space.
+     * @return True, when the record was written.
+     */
+    [[nodiscard]] bool contains(const storage::RecordIdentifier record_identifier) const
+    {
+        return this->may_contain(record_identifier) &&
+               std::binary_search(_record_identifiers.begin(), _record_identifiers.end(),
+                                  static_cast<std::uint64_t>(record_identifier));
+    }
+
+    /**
+     * @param table_id Id of the table.
+     * @return Images of all records written to the given table, may be nullptr.
+     */
+    [[nodiscard]] std::vector<Image> *images(const table::Table::id_t table_id)
+    {
+        auto iterator = _images.find(table_id);
+        return iterator != _images.end() ? &iterator->second : nullptr;
+    }
+
+  private:
+    // Bits in the filter per written record.
+    static constexpr std::size_t bits_per_record = 8u;
+
+    // Number of hash functions (derived by double hashing).
+    static constexpr std::uint32_t count_hashes = 3u;
+
+    // Bloom filter over the written record identifiers.
+    std::vector<std::uint64_t> _filter;
+
+    // Sorted written record identifiers for exact lookups.
+    std::vector<std::uint64_t> _record_identifiers;
+
+    // Images of written records, grouped by table.
+    std::unordered_map<table::Table::id_t, std::vector<Image>> _images;
+
+    /**
+     * Derives two hashes from a record identifier for double hashing.
+     * @param record_identifier Record identifier.
+     * @return Pair of hashes, the second one is odd.
+     */
+    static std::pair<std::uint64_t, std::uint64_t> hash(const storage::RecordIdentifier record_identifier)
+    {
+        auto key = static_cast<std::uint64_t>(record_identifier);
+        key ^= key >> 33u;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33u;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33u;
+        return {key, (key >> 32u) | 1u};
+    }
+};
+} // namespace beedb::concurrency
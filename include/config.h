@@ -42,7 +42,14 @@ class Config
     ///// COMPILE TIME OPTIONS - CHANGES REQUIRE REBUILDING
     static constexpr std::uint16_t page_size = 4096;
     static constexpr std::uint16_t b_plus_tree_page_size = 1024;
-    static constexpr auto max_clients = 64u;
+    static constexpr auto statistic_histogram_buckets = 16u;
+    static constexpr auto statistic_most_common_values = 8u;
+    static constexpr auto statistic_cardinality_feedback_capacity = 1024u;
+    static constexpr auto optimizer_memo_capacity = 256u;
+    static constexpr auto result_chunk_size = 64u * 1024u;
+    static constexpr auto max_request_size = 64u * 1024u * 1024u;
+    static constexpr auto max_queued_response_size = 1024u * 1024u;
+    static constexpr auto output_sample_rows = 1000u;
     static constexpr auto cli_history_file = "beedb-cli.txt";
 
   public:
@@ -73,6 +80,13 @@ class Config
     static constexpr auto k_OptimizationDisableOptimization = "no_optimization";
 
     static constexpr auto k_PrintExecutionStatistics = "print_execution_statistics";
+    static constexpr auto k_StatementTimeout = "statement_timeout";
+    static constexpr auto k_PerfCounters = "perf_counters";
+
+    static constexpr auto k_AnalyzeSamplePages = "analyze_sample_pages";
+    static constexpr auto k_AutoAnalyzeThreshold = "auto_analyze_threshold";
+
+    static constexpr auto k_CheckpointInterval = "checkpoint_interval";
 
     // this object represents a ConfigValue in the map and stores some meta information
     struct ConfigMapValue
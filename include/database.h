@@ -24,11 +24,15 @@
 #include <atomic>
 #include <buffer/manager.h>
 #include <concurrency/transaction_manager.h>
+#include <condition_variable>
 #include <config.h>
 #include <cstdint>
 #include <functional>
 #include <index/type.h>
+#include <limits>
 #include <io/execution_callback.h>
+#include <recovery/log_manager.h>
+#include <recovery/recovery_manager.h>
 #include <shared_mutex>
 #include <statistic/system_statistics.h>
 #include <storage/manager.h>
@@ -37,8 +41,11 @@
 #include <table/table.h>
 #include <table/table_disk_manager.h>
 #include <table/tuple.h>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace beedb
 {
@@ -50,12 +57,22 @@ class Database
 
     /**
      * Boots the database management system.
+     * When the database was not shut down clean, the pages are recovered
+     * from the write-ahead log first.
      * During the boot, all persisted tables, their schemas and indices
      * will be loaded to memory.
      * All indices will be filled with data from disk.
      */
     void boot();
 
+    /**
+     * Takes a fuzzy checkpoint and persists its LSN, so that
+     * recovery starts at this checkpoint.
+     *
+     * @param recovery_lsn Dirty pages changed before this LSN are written back; all by default.
+     */
+    void checkpoint(recovery::lsn_t recovery_lsn = std::numeric_limits<recovery::lsn_t>::max());
+
     /**
      * @return Instance of the TableDiskManager.
      */
@@ -131,6 +148,25 @@ class Database
         return nullptr;
     }
 
+    /**
+     * @return All tables created by the user (no system tables).
+     */
+    [[nodiscard]] std::vector<table::Table *> tables()
+    {
+        std::shared_lock _{_tables_latch};
+
+        std::vector<table::Table *> tables;
+        for (auto &table : _tables)
+        {
+            if (table.second->is_virtual() == false)
+            {
+                tables.push_back(table.second);
+            }
+        }
+
+        return tables;
+    }
+
     table::Table *operator[](const std::string &table_name)
     {
         std::shared_lock _{_tables_latch};
@@ -158,6 +194,30 @@ class Database
     void create_index(concurrency::Transaction *transaction, const table::Column &column, index::Type type,
                       const std::string &name, bool is_unique);
 
+    /**
+     * Scans the given table and computes the statistics (cardinality,
+     * histograms, distinct values, ...) of the table and all its columns.
+     * The table and column statistics will be persisted.
+     * When sampling, only the given number of randomly chosen pages is
+     * read; the cardinality is extrapolated from the sample.
+     *
+     * @param transaction Transaction to scan the table and persist the statistics for.
+     * @param table Table to analyze.
+     * @param sample_pages Number of pages to sample; 0 scans all pages.
+     * @return Number of analyzed rows.
+     */
+    std::uint64_t analyze(concurrency::Transaction *transaction, table::Table &table, std::uint32_t sample_pages = 0u);
+
+    /**
+     * Notifies the database about modified rows of a table.
+     * When the number of modified rows since the last analyze exceeds
+     * the configured threshold, the table will be analyzed in the background.
+     *
+     * @param table Modified table.
+     * @param count_rows Number of inserted, updated, or deleted rows.
+     */
+    void modified(table::Table &table, std::uint64_t count_rows);
+
   private:
     enum SystemPageIds : storage::Page::id_t
     {
@@ -166,13 +226,16 @@ class Database
         Columns = 2,
         Indices = 3,
         Statistics = 4,
+        ColumnStatistics = 5,
     };
 
     Config &_config;
     storage::Manager _storage_manager;
+    recovery::LogManager _log_manager;
     buffer::Manager _buffer_manager;
     table::TableDiskManager _table_disk_manager;
     concurrency::TransactionManager _transaction_manager;
+    recovery::RecoveryManager _recovery_manager;
 
     std::unordered_map<std::string, table::Table *> _tables;
     std::shared_mutex _tables_latch;
@@ -183,6 +246,23 @@ class Database
 
     statistic::SystemStatistics _statistics;
 
+    // Background analyze of tables with many modified rows.
+    std::thread _auto_analyze_thread;
+    std::mutex _auto_analyze_latch;
+    std::condition_variable _auto_analyze_condition;
+    std::unordered_set<table::Table *> _auto_analyze_tables;
+    bool _is_running = true;
+
+    // Periodic checkpoints. The thread is stopped like the auto analyze thread,
+    // the checkpoint latch serializes checkpoints.
+    std::thread _checkpoint_thread;
+    std::condition_variable _checkpoint_condition;
+    std::mutex _checkpoint_latch;
+    recovery::lsn_t _checkpoint_lsn = 0u;
+
+    // True, once the database booted; only booted databases are written on shutdown.
+    bool _is_booted = false;
+
     /**
      * Initializes the database. When the database is empty,
      * we will create a new database schema containing all meta tables.
@@ -191,13 +271,43 @@ class Database
      */
     void initialize_database(bool create_schema);
 
+    /**
+     * Recovers the pages from the write-ahead log, starting at the latest checkpoint.
+     *
+     * @return The highest timestamp found in the log.
+     */
+    concurrency::timestamp::timestamp_t recover();
+
+    /**
+     * Takes checkpoints in the configured interval until the database shuts down.
+     * Each checkpoint writes back the pages dirty since before the previous one.
+     */
+    void checkpoint_periodically();
+
+    /**
+     * Analyzes tables scheduled by Database::modified() until the database shuts down.
+     */
+    void auto_analyze();
+
     /**
      * Persists the table statistics.
      *
      * @param table Table
      * @param cardinality Cardinality
+     * @param transaction Transaction to persist the statistics for; a new one when nullptr.
+     */
+    void persist_table_statistics(table::Table *table, std::uint64_t cardinality,
+                                  concurrency::Transaction *transaction = nullptr);
+
+    /**
+     * Persists the statistic of a single column, replacing the former statistic.
+     *
+     * @param transaction Transaction to persist the statistic for.
+     * @param column_id Id of the column.
+     * @param statistic Statistic of the column.
      */
-    void persist_table_statistics(table::Table *table, std::uint64_t cardinality);
+    void persist_column_statistics(concurrency::Transaction *transaction, std::int32_t column_id,
+                                   const statistic::ColumnStatistic &statistic);
 };
 
 } // namespace beedb
@@ -0,0 +1,94 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include "result.h"
+#include "session.h"
+#include <config.h>
+#include <database.h>
+#include <string>
+
+namespace beedb::embedded
+{
+/**
+ * Embedded, in-process BeeDB: Opens (or creates) a database file and
+ * boots the database, without starting the server. Statements are
+ * executed by sessions, results are handed out as typed rows or
+ * batches of rows.
+ *
+ * Usage:
+ *  auto bee_db = beedb::embedded::Instance{"bee.db"};
+ *  auto session = bee_db.session();
+ *  auto result = session.execute("SELECT * FROM ...;");
+ *  for (const auto row : result.rows()) { row.get<std::int32_t>(0); }
+ */
+class Instance
+{
+  public:
+    /**
+     * Opens the database file and boots the database.
+     *
+     * @param file_name Name of the database file.
+     * @param config Configuration of the database.
+     */
+    explicit Instance(const std::string &file_name, Config &&config = Instance::default_config());
+    ~Instance() = default;
+
+    /**
+     * @return Configuration matching the defaults of the server.
+     */
+    [[nodiscard]] static Config default_config();
+
+    /**
+     * @return New session on the database.
+     */
+    [[nodiscard]] Session session()
+    {
+        return Session{_database};
+    }
+
+    /**
+     * Executes a single statement in a session of its own.
+     *
+     * @param statement SQL statement.
+     * @return Result of the statement.
+     */
+    Result execute(const std::string &statement)
+    {
+        return this->session().execute(statement);
+    }
+
+    [[nodiscard]] Database &database()
+    {
+        return _database;
+    }
+
+    [[nodiscard]] Config &config()
+    {
+        return _config;
+    }
+
+  private:
+    Config _config;
+    Database _database;
+};
+} // namespace beedb::embedded
@@ -0,0 +1,352 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception/execution_exception.h>
+#include <optional>
+#include <storage/page.h>
+#include <string>
+#include <string_view>
+#include <table/date.h>
+#include <table/schema.h>
+#include <table/tuple.h>
+#include <table/value.h>
+#include <type_traits>
+#include <vector>
+
+namespace beedb::embedded
+{
+/**
+ * A single result row, read directly from the row buffer of the
+ * result. Values are accessed typed by their position in the
+ * result (as listed by the SELECT) or by the name of the column.
+ *
+ * Supported types are std::int32_t (INT), std::int64_t (LONG),
+ * double (DECIMAL), table::Date (DATE), std::string_view and
+ * std::string (CHAR), and table::Value for any type.
+ */
+class Row
+{
+  public:
+    Row(const table::Schema &schema, const std::byte *data) : _schema(schema), _data(data)
+    {
+    }
+
+    ~Row() = default;
+
+    /**
+     * @return Number of values in the row.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return _schema.size();
+    }
+
+    /**
+     * @param index Position of the column in the result.
+     * @return Typed value of the column.
+     */
+    template <typename T> [[nodiscard]] T get(const std::size_t index) const
+    {
+        return this->read<T>(_schema.column_order()[index]);
+    }
+
+    /**
+     * @param column_name Name (or alias) of the column.
+     * @return Typed value of the column.
+     */
+    template <typename T> [[nodiscard]] T get(const std::string &column_name) const
+    {
+        const auto index = _schema.column_index(column_name);
+        if (index.has_value() == false)
+        {
+            throw exception::ExecutionException("Column " + column_name + " is not part of the result.");
+        }
+
+        return this->read<T>(index.value());
+    }
+
+    /**
+     * @param index Position of the column in the result.
+     * @return True, when the value is NULL.
+     */
+    [[nodiscard]] bool is_null(const std::size_t index) const
+    {
+        return this->read<table::Value>(_schema.column_order()[index]) == nullptr;
+    }
+
+  private:
+    const table::Schema &_schema;
+    const std::byte *_data;
+
+    /**
+     * Reads a value of the given column (index in the schema).
+     */
+    template <typename T> [[nodiscard]] T read(const std::size_t schema_index) const
+    {
+        const auto &type = _schema[schema_index].type();
+        const auto *data = &_data[_schema.offset(schema_index)];
+
+        if constexpr (std::is_same<T, table::Value>::value)
+        {
+            auto tuple = table::Tuple{_schema, storage::RecordIdentifier{storage::Page::MEMORY_TABLE_PAGE_ID, 0u},
+                                      nullptr, const_cast<std::byte *>(_data)};
+            return tuple.get(schema_index);
+        }
+        else if constexpr (std::is_same<T, std::string_view>::value || std::is_same<T, std::string>::value)
+        {
+            this->expect(schema_index, type == table::Type::CHAR);
+            const auto *chars = reinterpret_cast<const char *>(data);
+            return T{chars, strnlen(chars, type.dynamic_length())};
+        }
+        else
+        {
+            if constexpr (std::is_same<T, std::int32_t>::value)
+            {
+                this->expect(schema_index, type == table::Type::INT);
+            }
+            else if constexpr (std::is_same<T, std::int64_t>::value)
+            {
+                this->expect(schema_index, type == table::Type::LONG);
+            }
+            else if constexpr (std::is_same<T, double>::value)
+            {
+                this->expect(schema_index, type == table::Type::DECIMAL);
+            }
+            else
+            {
+                static_assert(std::is_same<T, table::Date>::value, "Type is not supported by result rows.");
+                this->expect(schema_index, type == table::Type::DATE);
+            }
+
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+    }
+
+    void expect(const std::size_t schema_index, const bool is_matching_type) const
+    {
+        if (is_matching_type == false)
+        {
+            throw exception::ResultTypeMismatchException(static_cast<std::string>(_schema.terms()[schema_index]),
+                                                         _schema[schema_index].type().name());
+        }
+    }
+};
+
+/**
+ * A batch of result rows, stored row by row in a contiguous buffer.
+ * The batch can be iterated row by row or read column-wise.
+ * The batch is a view; neither the schema nor the rows are owned.
+ */
+class RowBatch
+{
+  public:
+    class iterator
+    {
+      public:
+        iterator(const RowBatch &batch, const std::size_t index) : _batch(batch), _index(index)
+        {
+        }
+
+        ~iterator() = default;
+
+        Row operator*() const
+        {
+            return _batch[_index];
+        }
+
+        iterator &operator++()
+        {
+            ++_index;
+            return *this;
+        }
+
+        bool operator!=(const iterator &other) const
+        {
+            return _index != other._index;
+        }
+
+      private:
+        const RowBatch &_batch;
+        std::size_t _index;
+    };
+
+    RowBatch(const table::Schema &schema, const std::byte *data, const std::size_t count_rows)
+        : _schema(schema), _data(data), _count_rows(count_rows)
+    {
+    }
+
+    ~RowBatch() = default;
+
+    /**
+     * @return Schema of all rows in the batch.
+     */
+    [[nodiscard]] const table::Schema &schema() const
+    {
+        return _schema;
+    }
+
+    /**
+     * @return Number of rows in the batch.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return _count_rows;
+    }
+
+    /**
+     * @return True, when the batch holds no row.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _count_rows == 0u;
+    }
+
+    Row operator[](const std::size_t index) const
+    {
+        return Row{_schema, &_data[index * _schema.row_size()]};
+    }
+
+    /**
+     * Reads all values of a single column.
+     *
+     * @param index Position of the column in the result.
+     * @return Typed values of the column, one per row.
+     */
+    template <typename T> [[nodiscard]] std::vector<T> column(const std::size_t index) const
+    {
+        auto values = std::vector<T>{};
+        values.reserve(_count_rows);
+        for (auto i = 0u; i < _count_rows; ++i)
+        {
+            values.emplace_back(this->operator[](i).template get<T>(index));
+        }
+
+        return values;
+    }
+
+    [[nodiscard]] iterator begin() const
+    {
+        return iterator{*this, 0u};
+    }
+
+    [[nodiscard]] iterator end() const
+    {
+        return iterator{*this, _count_rows};
+    }
+
+  private:
+    const table::Schema &_schema;
+    const std::byte *_data;
+    const std::size_t _count_rows;
+};
+
+/**
+ * Materialized result of a statement, owning schema and rows.
+ * Statements without result set (e.g., INSERT or CREATE TABLE)
+ * have no schema.
+ */
+class Result
+{
+  public:
+    Result() = default;
+    Result(Result &&) = default;
+    ~Result() = default;
+
+    /**
+     * @return True, when the statement produced a result set.
+     */
+    [[nodiscard]] bool has_schema() const
+    {
+        return _schema.has_value();
+    }
+
+    /**
+     * @return Schema of the result set.
+     */
+    [[nodiscard]] const table::Schema &schema() const
+    {
+        return _schema.value();
+    }
+
+    /**
+     * @return Number of rows in the result set.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return _count_rows;
+    }
+
+    /**
+     * @return True, when the result set holds no row.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _count_rows == 0u;
+    }
+
+    /**
+     * @return All rows of the result set as a single batch; the batch
+     *         may only be used while the result is alive.
+     */
+    [[nodiscard]] RowBatch rows() const
+    {
+        return RowBatch{_schema.value(), _rows.data(), _count_rows};
+    }
+
+    /**
+     * @return Time spent for building and executing the statement.
+     */
+    [[nodiscard]] std::chrono::milliseconds execution_time() const
+    {
+        return _execution_time;
+    }
+
+    void schema(const table::Schema &schema)
+    {
+        _schema.emplace(schema);
+    }
+
+    void push_back(const std::byte *data, const std::size_t row_size)
+    {
+        _rows.insert(_rows.end(), data, data + row_size);
+        ++_count_rows;
+    }
+
+    void execution_time(const std::chrono::milliseconds execution_time)
+    {
+        _execution_time = execution_time;
+    }
+
+  private:
+    std::optional<table::Schema> _schema;
+    std::vector<std::byte> _rows;
+    std::size_t _count_rows = 0u;
+    std::chrono::milliseconds _execution_time{0u};
+};
+} // namespace beedb::embedded
@@ -0,0 +1,106 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include "result.h"
+#include <concurrency/transaction.h>
+#include <cstdint>
+#include <database.h>
+#include <execution/cancellation.h>
+#include <functional>
+#include <io/execution_callback.h>
+#include <string>
+
+namespace beedb::embedded
+{
+/**
+ * A session executes statements on an in-process database, like a
+ * client connected to the server does, but without the network
+ * and result serialization. Transactions started by BEGIN TRANSACTION
+ * span multiple statements of the same session; a transaction
+ * still running when the session ends is aborted.
+ *
+ * A session executes one statement at a time; multiple sessions may
+ * run concurrently on the same database.
+ */
+class Session
+{
+  public:
+    explicit Session(Database &database) : _database(database)
+    {
+    }
+
+    Session(const Session &) = delete;
+    ~Session();
+
+    /**
+     * Executes a statement and materializes its result.
+     * Errors (parsing, planning, execution, or cancellation) are thrown.
+     *
+     * @param statement SQL statement.
+     * @return Result of the statement.
+     */
+    Result execute(const std::string &statement);
+
+    /**
+     * Executes a statement and streams its result in batches of rows;
+     * every batch is valid only during the callback.
+     * Errors (parsing, planning, execution, or cancellation) are thrown.
+     *
+     * @param statement SQL statement.
+     * @param batch_callback Callback invoked for every batch of rows.
+     * @param batch_size Maximal number of rows per batch.
+     * @return Number of rows produced by the statement.
+     */
+    std::uint64_t execute(const std::string &statement, const std::function<void(const RowBatch &)> &batch_callback,
+                          std::size_t batch_size = 1024u);
+
+    /**
+     * Cancels the running statement; may be called by any thread.
+     */
+    void cancel() noexcept
+    {
+        _cancellation.request();
+    }
+
+    /**
+     * @return True, when a transaction was started and is not finished yet.
+     */
+    [[nodiscard]] bool is_in_transaction() const
+    {
+        return _transaction != nullptr;
+    }
+
+  private:
+    Database &_database;
+    concurrency::Transaction *_transaction = nullptr;
+    execution::Cancellation _cancellation;
+
+    /**
+     * Executes the statement within the session's transaction (if any)
+     * and throws when the execution failed.
+     *
+     * @return Time spent for building and executing the statement.
+     */
+    std::chrono::milliseconds run(const std::string &statement, io::ExecutionCallback &execution_callback);
+};
+} // namespace beedb::embedded
@@ -35,6 +35,17 @@ class AbortTransactionException final : public DatabaseException
     ~AbortTransactionException() override = default;
 };
 
+class ReadOnlyTransactionException final : public DatabaseException
+{
+  public:
+    ReadOnlyTransactionException()
+        : DatabaseException(DatabaseException::Concurrency, "Can not write in a read-only transaction")
+    {
+    }
+
+    ~ReadOnlyTransactionException() override = default;
+};
+
 class TransactionDisabledException final : public DatabaseException
 {
   public:
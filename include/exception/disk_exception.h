@@ -77,4 +77,27 @@ class CanNotOpenStorageFile final : public DiskException
 
     ~CanNotOpenStorageFile() override = default;
 };
+
+class IncompatibleStorageFormatException final : public DiskException
+{
+  public:
+    IncompatibleStorageFormatException(const std::uint32_t format_version, const std::uint32_t expected_format_version)
+        : DiskException("Storage file has format version " + std::to_string(format_version) + ", expected version " +
+                        std::to_string(expected_format_version) + "; please recreate the database.")
+    {
+    }
+
+    ~IncompatibleStorageFormatException() override = default;
+};
+
+class CanNotWriteLogException final : public DiskException
+{
+  public:
+    explicit CanNotWriteLogException(const std::string &file_name)
+        : DiskException("Can not write to log file '" + file_name + "'.")
+    {
+    }
+
+    ~CanNotWriteLogException() override = default;
+};
 } // namespace beedb::exception
\ No newline at end of file
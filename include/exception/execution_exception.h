@@ -55,4 +55,28 @@ class NotInTransactionException final : public ExecutionException
 
     ~NotInTransactionException() override = default;
 };
+
+class QueryCancelledException final : public ExecutionException
+{
+  public:
+    explicit QueryCancelledException(const bool is_timed_out)
+        : ExecutionException(is_timed_out ? "Query cancelled, the statement timeout was exceeded."
+                                          : "Query cancelled on request.")
+    {
+    }
+
+    ~QueryCancelledException() override = default;
+};
+
+class ResultTypeMismatchException final : public ExecutionException
+{
+  public:
+    ResultTypeMismatchException(const std::string &column_name, const std::string &column_type)
+        : ExecutionException("Column " + column_name + " of type " + column_type +
+                             " can not be read as the requested type.")
+    {
+    }
+
+    ~ResultTypeMismatchException() override = default;
+};
 } // namespace beedb::exception
\ No newline at end of file
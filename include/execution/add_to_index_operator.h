@@ -56,5 +56,14 @@ class AddToIndexOperator final : public UnaryOperator
     table::Schema _schema;
     const std::uint32_t _column_index;
     const std::shared_ptr<index::IndexInterface> _index;
+
+    /**
+     * Adds the (key,page) pair to the index; the insert is undone
+     * when the transaction aborts.
+     *
+     * @param key Key of the tuple.
+     * @param page_id Page of the tuple.
+     */
+    void put(std::int64_t key, storage::Page::id_t page_id);
 };
 } // namespace beedb::execution
\ No newline at end of file
@@ -92,6 +92,17 @@ class AggregateOperator : public UnaryOperator
         return _schema;
     }
 
+    [[nodiscard]] std::size_t memory_usage() const override
+    {
+        auto memory_usage = std::size_t{0u};
+        for (const auto &tile : _tiles)
+        {
+            memory_usage += tile.memory_usage();
+        }
+
+        return memory_usage;
+    }
+
   private:
     // The output schema, generated by this operator.
     const table::Schema _schema;
@@ -0,0 +1,70 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include "operator_interface.h"
+#include <cstdint>
+#include <database.h>
+#include <table/table.h>
+#include <vector>
+
+namespace beedb::execution
+{
+/**
+ * Operator that computes and persists the statistics
+ * of a set of tables by sampling their pages.
+ */
+class AnalyzeOperator final : public OperatorInterface
+{
+  public:
+    AnalyzeOperator(Database &database, concurrency::Transaction *transaction, std::vector<table::Table *> &&tables,
+                    std::uint32_t sample_pages);
+    ~AnalyzeOperator() override = default;
+
+    void open() override
+    {
+    }
+
+    util::optional<table::Tuple> next() override;
+
+    void close() override
+    {
+    }
+
+    [[nodiscard]] const table::Schema &schema() const override
+    {
+        return _schema;
+    }
+
+    [[nodiscard]] bool yields_data() const override
+    {
+        return false;
+    }
+
+  private:
+    const table::Schema _schema;
+    Database &_database;
+    std::vector<table::Table *> _tables;
+    const std::uint32_t _sample_pages;
+};
+} // namespace beedb::execution
@@ -0,0 +1,90 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <exception/execution_exception.h>
+
+namespace beedb::execution
+{
+/**
+ * Cancellation of a running statement, either requested (e.g., by
+ * the client) or by exceeding the statement timeout. Operators running
+ * for long (scans, joins, and sorts) check the cancellation cooperatively.
+ */
+class Cancellation
+{
+  public:
+    Cancellation() = default;
+    ~Cancellation() = default;
+
+    /**
+     * Drops former requests; called when a worker takes a new message,
+     * requests arriving while the message is parsed and planned are kept.
+     */
+    void reset() noexcept
+    {
+        _is_requested.store(false, std::memory_order_relaxed);
+        _deadline = std::chrono::steady_clock::time_point::max();
+    }
+
+    /**
+     * Starts the execution of a statement.
+     *
+     * @param timeout Time the statement may run, zero for no limit.
+     */
+    void start(const std::chrono::milliseconds timeout) noexcept
+    {
+        _deadline = timeout.count() > 0 ? std::chrono::steady_clock::now() + timeout
+                                        : std::chrono::steady_clock::time_point::max();
+    }
+
+    /**
+     * Requests to cancel the running statement; may be called by any thread.
+     */
+    void request() noexcept
+    {
+        _is_requested.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * Throws, when the statement was cancelled or ran out of time.
+     */
+    void check() const
+    {
+        if (_is_requested.load(std::memory_order_relaxed))
+        {
+            throw exception::QueryCancelledException{false};
+        }
+
+        if (_deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() > _deadline)
+        {
+            throw exception::QueryCancelledException{true};
+        }
+    }
+
+  private:
+    std::atomic_bool _is_requested{false};
+    std::chrono::steady_clock::time_point _deadline = std::chrono::steady_clock::time_point::max();
+};
+} // namespace beedb::execution
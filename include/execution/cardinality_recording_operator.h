@@ -0,0 +1,64 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include "unary_operator.h"
+#include <cstdint>
+#include <optional>
+#include <table/schema.h>
+
+namespace beedb::execution
+{
+/**
+ * Passes all tuples of the child and counts them. Once the child
+ * is exhausted, the count is written to the given cardinality
+ * (e.g. the actual cardinality of the logical node the child
+ * was built from). Children that are not fully consumed (e.g. below
+ * a LIMIT) leave the cardinality untouched.
+ */
+class CardinalityRecordingOperator final : public UnaryOperator
+{
+  public:
+    CardinalityRecordingOperator(concurrency::Transaction *transaction, std::unique_ptr<OperatorInterface> &&child,
+                                 std::optional<std::uint64_t> &cardinality);
+    ~CardinalityRecordingOperator() override = default;
+
+    void open() override;
+    util::optional<table::Tuple> next() override;
+    void close() override;
+
+    [[nodiscard]] bool yields_data() const override
+    {
+        return this->child()->yields_data();
+    }
+
+    [[nodiscard]] const table::Schema &schema() const override
+    {
+        return this->child()->schema();
+    }
+
+  private:
+    std::optional<std::uint64_t> &_cardinality;
+    std::uint64_t _count = 0u;
+};
+} // namespace beedb::execution
@@ -0,0 +1,64 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include "unary_operator.h"
+#include <table/schema.h>
+#include <table/tuple.h>
+
+namespace beedb::execution
+{
+/**
+ * Produces no tuples. The child only provides the
+ * schema and is neither opened nor executed.
+ */
+class EmptyOperator final : public UnaryOperator
+{
+  public:
+    EmptyOperator(concurrency::Transaction *transaction, std::unique_ptr<OperatorInterface> &&child)
+        : UnaryOperator(transaction)
+    {
+        this->child(std::move(child));
+    }
+
+    ~EmptyOperator() override = default;
+
+    void open() override
+    {
+    }
+
+    util::optional<table::Tuple> next() override
+    {
+        return {};
+    }
+
+    void close() override
+    {
+    }
+
+    [[nodiscard]] const table::Schema &schema() const override
+    {
+        return this->child()->schema();
+    }
+};
+} // namespace beedb::execution
@@ -56,6 +56,7 @@ class HashTable
     {
         table::Tuple in_memory_tuple(tuple);
         this->_map[tuple.get(_key_index)].push_back(std::move(in_memory_tuple));
+        this->_memory_usage += sizeof(table::Tuple) + tuple.schema().row_size();
     }
 
     const std::vector<table::Tuple> &get(const table::Value &key)
@@ -63,9 +64,18 @@ class HashTable
         return _map[key];
     }
 
+    /**
+     * @return Bytes of memory held by the tuples in the hash table.
+     */
+    [[nodiscard]] std::size_t memory_usage() const
+    {
+        return _memory_usage;
+    }
+
   private:
     const std::uint32_t _key_index;
     std::unordered_map<table::Value, std::vector<table::Tuple>> _map;
+    std::size_t _memory_usage = 0u;
 };
 
 /**
@@ -88,6 +98,11 @@ class HashJoinOperator final : public BinaryOperator
         return _schema;
     }
 
+    [[nodiscard]] std::size_t memory_usage() const override
+    {
+        return _hash_table.memory_usage() + _tuple_buffer.memory_usage();
+    }
+
   private:
     const table::Schema _schema;
     const std::uint32_t _left_index;
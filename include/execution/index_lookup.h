@@ -0,0 +1,145 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <index/index_interface.h>
+#include <limits>
+#include <memory>
+#include <storage/page.h>
+#include <unordered_set>
+#include <vector>
+
+namespace beedb::execution
+{
+/**
+ * Key (range) that have to be looked up in the index.
+ * May be a range or a single key.
+ */
+class KeyRange
+{
+  public:
+    explicit KeyRange(const std::int64_t single_key) : _from(single_key), _to(single_key)
+    {
+    }
+
+    KeyRange(const std::int64_t from, const std::int64_t to) : _from(from), _to(to)
+    {
+    }
+
+    ~KeyRange() = default;
+
+    [[nodiscard]] bool is_single_key() const
+    {
+        return _from == _to;
+    }
+    [[nodiscard]] std::int64_t single_key() const
+    {
+        return _from;
+    }
+    [[nodiscard]] std::int64_t from() const
+    {
+        return _from;
+    }
+    [[nodiscard]] std::int64_t to() const
+    {
+        return _to;
+    }
+
+    bool operator<(const KeyRange &other) const
+    {
+        return _from < other._from;
+    }
+
+    bool operator==(const KeyRange &other) const
+    {
+        return _from == other._from && _to == other._to;
+    }
+
+  private:
+    const std::int64_t _from;
+    const std::int64_t _to;
+};
+} // namespace beedb::execution
+
+namespace std
+{
+template <> struct hash<beedb::execution::KeyRange>
+{
+  public:
+    std::size_t operator()(const beedb::execution::KeyRange &range) const
+    {
+        return std::hash<std::int64_t>()(range.from()) ^ std::hash<std::int64_t>()(range.to());
+    }
+};
+} // namespace std
+
+namespace beedb::execution
+{
+/**
+ * Tree of index lookups, resolving to the ids of all pages that may
+ * contain qualifying rows. Leafs probe a single index for key ranges;
+ * inner nodes intersect (conjunctions) or unite (disjunctions) the
+ * sorted page ids of their children, before any page is fetched.
+ */
+class IndexLookup
+{
+  public:
+    enum Type : std::uint8_t
+    {
+        Probe,
+        Intersection,
+        Union
+    };
+
+    IndexLookup(std::shared_ptr<index::IndexInterface> index, std::unordered_set<KeyRange> &&key_ranges)
+        : _type(Type::Probe), _index(std::move(index)), _key_ranges(std::move(key_ranges))
+    {
+    }
+
+    IndexLookup(const Type type, std::unique_ptr<IndexLookup> &&left, std::unique_ptr<IndexLookup> &&right)
+        : _type(type), _left(std::move(left)), _right(std::move(right))
+    {
+    }
+
+    ~IndexLookup() = default;
+
+    /**
+     * @return Sorted and distinct ids of pages that may contain qualifying rows.
+     */
+    [[nodiscard]] std::vector<storage::Page::id_t> pages() const;
+
+  private:
+    const Type _type;
+
+    // Probe
+    std::shared_ptr<index::IndexInterface> _index;
+    std::unordered_set<KeyRange> _key_ranges;
+
+    // Intersection and union
+    std::unique_ptr<IndexLookup> _left;
+    std::unique_ptr<IndexLookup> _right;
+
+    [[nodiscard]] std::vector<storage::Page::id_t> probe() const;
+};
+} // namespace beedb::execution
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "index_lookup.h"
 #include "operator_interface.h"
 #include "tuple_buffer.h"
 #include <buffer/manager.h>
@@ -35,70 +36,6 @@
 #include <unordered_set>
 #include <vector>
 
-namespace beedb::execution
-{
-/**
- * Key (range) that have to be looked up in the.
- * May be a range or a single key.
- */
-class KeyRange
-{
-  public:
-    explicit KeyRange(const std::int64_t single_key) : _from(single_key), _to(std::numeric_limits<std::int64_t>::max())
-    {
-    }
-
-    KeyRange(const std::int64_t from, const std::int64_t to) : _from(from), _to(to)
-    {
-    }
-
-    ~KeyRange() = default;
-
-    [[nodiscard]] bool is_single_key() const
-    {
-        return _to == std::numeric_limits<std::int64_t>::max();
-    }
-    [[nodiscard]] std::int64_t single_key() const
-    {
-        return _from;
-    }
-    [[nodiscard]] std::int64_t from() const
-    {
-        return _from;
-    }
-    [[nodiscard]] std::int64_t to() const
-    {
-        return _to;
-    }
-
-    bool operator<(const KeyRange &other) const
-    {
-        return _from < other._from;
-    }
-
-    bool operator==(const KeyRange &other) const
-    {
-        return _from == other._from && _to == other._to;
-    }
-
-  private:
-    const std::int64_t _from;
-    const std::int64_t _to;
-};
-} // namespace beedb::execution
-
-namespace std
-{
-template <> struct hash<beedb::execution::KeyRange>
-{
-  public:
-    std::size_t operator()(const beedb::execution::KeyRange &range) const
-    {
-        return std::hash<std::int64_t>()(range.from()) ^ std::hash<std::int64_t>()(range.to());
-    }
-};
-} // namespace std
-
 namespace beedb::execution
 {
 
@@ -106,6 +43,12 @@ namespace beedb::execution
  * Takes an index and keys to be looked up in the index
  * and scans only over pages found in the index instead
  * of scanning all pages from the table.
+ * Using an index lookup tree, page ids of multiple indices
+ * can be intersected or united before any page is fetched.
+ *
+ * In ordered mode, keys of a range index are looked up in batches
+ * and rows are emitted in key order, so that no sort is needed
+ * afterwards.
  */
 class IndexScanOperator final : public OperatorInterface
 {
@@ -114,6 +57,13 @@ class IndexScanOperator final : public OperatorInterface
                       const table::Schema &schema, buffer::Manager &buffer_manager,
                       table::TableDiskManager &table_disk_manager, std::unordered_set<KeyRange> &&key_ranges,
                       std::shared_ptr<index::IndexInterface> index);
+    IndexScanOperator(concurrency::Transaction *transaction, const std::uint32_t scan_page_limit,
+                      const table::Schema &schema, buffer::Manager &buffer_manager,
+                      table::TableDiskManager &table_disk_manager, std::unique_ptr<IndexLookup> &&lookup);
+    IndexScanOperator(concurrency::Transaction *transaction, const table::Schema &schema,
+                      buffer::Manager &buffer_manager, table::TableDiskManager &table_disk_manager,
+                      std::shared_ptr<index::IndexInterface> index,
+                      const table::Schema::ColumnIndexType key_column_index, const KeyRange &key_range);
     ~IndexScanOperator() override = default;
 
     void open() override;
@@ -130,12 +80,33 @@ class IndexScanOperator final : public OperatorInterface
     const table::Schema _schema;
     buffer::Manager &_buffer_manager;
     table::TableDiskManager &_table_disk_manager;
-    std::unordered_set<KeyRange> _key_ranges;
-    std::shared_ptr<index::IndexInterface> _index;
+    std::unique_ptr<IndexLookup> _lookup;
+
+    // Ordered mode.
+    static constexpr std::size_t ordered_batch_keys = 128u;
+    const bool _is_ordered = false;
+    std::shared_ptr<index::IndexInterface> _ordered_index;
+    const table::Schema::ColumnIndexType _key_column_index = 0u;
+    std::int64_t _next_key = 0;
+    const std::int64_t _last_key = 0;
+    bool _is_exhausted = false;
 
     std::queue<storage::Page::id_t> _pages_to_scan;
     std::vector<storage::Page::id_t> _pinned_pages;
 
     TupleBuffer _buffer;
+
+    /**
+     * Reads the next pages from the queue of pages to scan into the buffer.
+     */
+    void read_pages();
+
+    /**
+     * Looks up the next batch of keys and reads the rows of all
+     * pages containing these keys into the buffer, ordered by key.
+     */
+    void read_ordered();
+
+    [[nodiscard]] std::int64_t key(const table::Tuple &tuple) const;
 };
 } // namespace beedb::execution
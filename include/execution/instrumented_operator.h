@@ -0,0 +1,99 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include "operator_statistics.h"
+#include "unary_operator.h"
+#include <buffer/manager.h>
+#include <chrono>
+#include <cstddef>
+#include <table/schema.h>
+#include <util/perf.h>
+#include <vector>
+
+namespace beedb::execution
+{
+/**
+ * Decorates an operator and records its runtime statistics
+ * (time, produced rows, next() calls, pinned pages, and peak memory)
+ * for EXPLAIN ANALYZE. The decorator is only built into plans
+ * that are analyzed; other plans do not pay for it.
+ */
+class InstrumentedOperator final : public UnaryOperator
+{
+  public:
+    InstrumentedOperator(concurrency::Transaction *transaction, std::unique_ptr<OperatorInterface> &&child,
+                         OperatorStatistics &statistics);
+    ~InstrumentedOperator() override = default;
+
+    void open() override;
+    util::optional<table::Tuple> next() override;
+    void close() override;
+
+    [[nodiscard]] bool yields_data() const override
+    {
+        return this->child()->yields_data();
+    }
+
+    [[nodiscard]] const table::Schema &schema() const override
+    {
+        return this->child()->schema();
+    }
+
+    [[nodiscard]] std::size_t memory_usage() const override
+    {
+        return this->child()->memory_usage();
+    }
+
+  private:
+    /**
+     * Clock, pins, and performance counters of the thread when a call to the child started.
+     */
+    struct Sample
+    {
+        std::chrono::steady_clock::time_point time;
+        buffer::Manager::AccessStatistics access_statistics;
+        std::vector<util::PerfCounter::read_format> performance_counters;
+    };
+
+    OperatorStatistics &_statistics;
+
+    [[nodiscard]] Sample sample() const
+    {
+        auto sample = Sample{std::chrono::steady_clock::now(), buffer::Manager::access_statistics(), {}};
+        if (this->_statistics.perf != nullptr)
+        {
+            this->_statistics.perf->sample(sample.performance_counters);
+        }
+
+        return sample;
+    }
+
+    /**
+     * Adds the time and pins since the given sample to the statistics.
+     *
+     * @param start Sample taken before calling the child.
+     */
+    void record(const Sample &start);
+};
+} // namespace beedb::execution
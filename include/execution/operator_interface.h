@@ -22,6 +22,7 @@
 
 #pragma once
 #include <concurrency/transaction.h>
+#include <cstddef>
 #include <table/schema.h>
 #include <table/tuple.h>
 #include <util/optional.h>
@@ -51,12 +52,32 @@ class OperatorInterface
 
     [[nodiscard]] virtual const table::Schema &schema() const = 0;
 
+    /**
+     * @return Bytes of memory held by the operator (e.g., for materialized tuples).
+     */
+    [[nodiscard]] virtual std::size_t memory_usage() const
+    {
+        return 0u;
+    }
+
   protected:
     [[nodiscard]] concurrency::Transaction *transaction() const
     {
         return _transaction;
     }
 
+    /**
+     * Throws, when the running statement was cancelled (on request or by the statement timeout).
+     * Operators running for long check this cooperatively.
+     */
+    void check_cancellation() const
+    {
+        if (_transaction != nullptr)
+        {
+            _transaction->check_cancellation();
+        }
+    }
+
   private:
     concurrency::Transaction *_transaction;
 };
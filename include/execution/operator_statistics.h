@@ -0,0 +1,58 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace beedb::util
+{
+class Perf;
+}
+
+namespace beedb::execution
+{
+/**
+ * Runtime statistics of a physical operator, recorded by the
+ * InstrumentedOperator while analyzing a query. Time, pins, and
+ * performance counters include the work of the operator's children.
+ */
+struct OperatorStatistics
+{
+    std::chrono::nanoseconds time{0u};
+    std::uint64_t count_rows = 0u;
+    std::uint64_t count_next_calls = 0u;
+    std::uint64_t count_pinned_pages = 0u;
+    std::uint64_t count_buffer_hits = 0u;
+    std::uint64_t count_buffer_misses = 0u;
+    std::size_t peak_memory = 0u;
+
+    // Started performance counters of the query, sampled around every call
+    // of the operator; nullptr when performance counters are disabled.
+    const util::Perf *perf = nullptr;
+    std::vector<std::pair<std::string, double>> performance_counters;
+};
+} // namespace beedb::execution
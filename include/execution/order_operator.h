@@ -102,6 +102,11 @@ class OrderOperator final : public UnaryOperator
         return _schema;
     }
 
+    [[nodiscard]] std::size_t memory_usage() const override
+    {
+        return _result_table != nullptr ? _result_table->memory_usage() : 0u;
+    }
+
   private:
     const table::Schema &_schema;
     const std::vector<std::pair<std::uint32_t, bool>> _order_columns;
@@ -32,9 +32,10 @@ class BeginTransactionOperator : public OperatorInterface
 {
   public:
     BeginTransactionOperator(concurrency::TransactionManager &transaction_manager,
-                             concurrency::TransactionCallback &transaction_callback)
+                             concurrency::TransactionCallback &transaction_callback,
+                             const concurrency::IsolationLevel isolation_level, const bool is_read_only)
         : OperatorInterface(nullptr), _transaction_manager(transaction_manager),
-          _transaction_callback(transaction_callback)
+          _transaction_callback(transaction_callback), _isolation_level(isolation_level), _is_read_only(is_read_only)
     {
     }
     ~BeginTransactionOperator() override = default;
@@ -57,6 +58,8 @@ class BeginTransactionOperator : public OperatorInterface
     const table::Schema _schema = {};
     concurrency::TransactionManager &_transaction_manager;
     concurrency::TransactionCallback &_transaction_callback;
+    const concurrency::IsolationLevel _isolation_level;
+    const bool _is_read_only;
 };
 
 class AbortTransactionOperator : public OperatorInterface
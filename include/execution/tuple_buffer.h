@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <table/tuple.h>
 #include <vector>
 
@@ -56,6 +57,15 @@ class TupleBuffer
         return std::move(_buffer[_head++]);
     }
 
+    /**
+     * @return Bytes of memory held by the buffered tuples.
+     */
+    [[nodiscard]] std::size_t memory_usage() const
+    {
+        const auto row_size = _buffer.empty() ? 0u : _buffer.front().schema().row_size();
+        return _buffer.capacity() * sizeof(table::Tuple) + _buffer.size() * row_size;
+    }
+
     void clear()
     {
         _buffer.clear();
@@ -54,6 +54,11 @@ class TupleBufferOperator final : public OperatorInterface
         return _schema;
     }
 
+    [[nodiscard]] std::size_t memory_usage() const override
+    {
+        return _tuple_buffer.memory_usage();
+    }
+
     void add(table::Tuple &tuple)
     {
         _tuple_buffer.add(std::move(tuple));
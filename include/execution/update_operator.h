@@ -23,7 +23,10 @@
 #pragma once
 #include "unary_operator.h"
 #include <buffer/manager.h>
+#include <concurrency/timestamp.h>
 #include <cstdint>
+#include <index/index_interface.h>
+#include <optional>
 #include <table/table_disk_manager.h>
 #include <table/value.h>
 #include <utility>
@@ -62,5 +65,56 @@ class UpdateOperator : public UnaryOperator
     table::TableDiskManager _table_disk_manager;
     buffer::Manager &_buffer_manager;
     std::vector<std::pair<table::Schema::ColumnIndexType, table::Value>> _new_column_values;
+
+    /**
+     * @param tuple Tuple.
+     * @param column_index Index of the column.
+     * @return Key of the column in an index, when the column type can be indexed.
+     */
+    static std::optional<std::int64_t> index_key(const table::Tuple &tuple,
+                                                 const table::Schema::ColumnIndexType column_index);
+
+    /**
+     * Adds the new key of an updated column to all indices of the column.
+     * The old key stays until no transaction can see the replaced version anymore.
+     * Added keys are removed on abort.
+     *
+     * @param tuple Updated tuple.
+     * @param column_index Index of the updated column.
+     * @param old_key Key of the column before the update.
+     */
+    void update_indices(const table::Tuple &tuple, const table::Schema::ColumnIndexType column_index,
+                        std::optional<std::int64_t> old_key);
+
+    /**
+     * Removes the key of a replaced version from an index,
+     * unless another version on the page still holds the key.
+     *
+     * @param buffer_manager Buffer manager to read the page.
+     * @param schema Schema of the table.
+     * @param index Index of the column.
+     * @param column_index Index of the column.
+     * @param key Replaced key.
+     * @param page_id Page of the updated record.
+     * @param oldest_active_time Begin time of the oldest running transaction.
+     */
+    static void remove_replaced_key(buffer::Manager &buffer_manager, const table::Schema &schema,
+                                    index::IndexInterface &index, table::Schema::ColumnIndexType column_index,
+                                    std::int64_t key, storage::Page::id_t page_id,
+                                    concurrency::timestamp::timestamp_t oldest_active_time);
+
+    /**
+     * @param buffer_manager Buffer manager to read the pages.
+     * @param schema Schema of the table.
+     * @param column_index Index of the column.
+     * @param key Key to look for.
+     * @param page_id Page to look at.
+     * @param oldest_active_time Begin time of the oldest running transaction.
+     * @return True, when a record on the page or one of its older versions holds the key
+     *         and is visible to a running or future transaction.
+     */
+    static bool is_key_on_page(buffer::Manager &buffer_manager, const table::Schema &schema,
+                               table::Schema::ColumnIndexType column_index, std::int64_t key,
+                               storage::Page::id_t page_id, concurrency::timestamp::timestamp_t oldest_active_time);
 };
 } // namespace beedb::execution
\ No newline at end of file
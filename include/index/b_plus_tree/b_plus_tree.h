@@ -55,6 +55,23 @@ template <typename K, typename V, bool U> class BPlusTree
      */
     void put(const K key, V value);
 
+    /**
+     * Removes the given key-value-pair from the tree. Nodes are not merged;
+     * a leaf may run empty and is still used for lookups and inserts.
+     *
+     * @param key
+     * @param value
+     * @return True, when the pair was stored and is removed.
+     */
+    bool remove(const K key, const V value);
+
+    /**
+     * @param key
+     * @param value
+     * @return True, when the tree stores the given key-value-pair.
+     */
+    [[nodiscard]] bool contains(const K key, const V value) const;
+
     /**
      * Finds the value by the given key.
      *
@@ -65,6 +82,17 @@ template <typename K, typename V, bool U> class BPlusTree
 
     [[nodiscard]] std::optional<std::set<V>> get(const K key_from, const K key_to) const;
 
+    /**
+     * Finds the key-value-pairs of the given key range in key order.
+     *
+     * @param key_from First key of the range (inclusive).
+     * @param key_to Last key of the range (inclusive).
+     * @param limit Maximal number of distinct keys.
+     * @return Key-value-pairs ordered by key.
+     */
+    [[nodiscard]] std::vector<std::pair<K, V>> get_ordered(const K key_from, const K key_to,
+                                                           const size_type limit) const;
+
     [[nodiscard]] Node *root() const
     {
         return _root;
@@ -190,6 +218,58 @@ template <typename K, typename V, bool U> void BPlusTree<K, V, U>::put(const K k
     }
 }
 
+template <typename K, typename V, bool U> bool BPlusTree<K, V, U>::remove(const K key, const V value)
+{
+    Node *leaf = this->locate_leaf(key);
+    const auto index = leaf->index(key);
+    if (index >= leaf->size() || leaf->leaf_key(index) != key)
+    {
+        return false;
+    }
+
+    if constexpr (U)
+    {
+        if (leaf->value(index) != value)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        auto &values = leaf->value(index);
+        if (values.erase(value) == 0u)
+        {
+            return false;
+        }
+
+        if (values.empty() == false)
+        {
+            return true;
+        }
+    }
+
+    leaf->remove_value(index);
+    return true;
+}
+
+template <typename K, typename V, bool U> bool BPlusTree<K, V, U>::contains(const K key, const V value) const
+{
+    const auto stored_value = this->get(key);
+    if (stored_value.has_value() == false)
+    {
+        return false;
+    }
+
+    if constexpr (U)
+    {
+        return stored_value.value() == value;
+    }
+    else
+    {
+        return stored_value->find(value) != stored_value->end();
+    }
+}
+
 template <typename K, typename V, bool U>
 std::pair<BPlusTreeNode<K, V, U> *, K> BPlusTree<K, V, U>::insert_into_inner(BPlusTree<K, V, U>::Node *inner_node,
                                                                              const K key,
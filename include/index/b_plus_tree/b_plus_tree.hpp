@@ -222,8 +222,7 @@ std::optional<std::set<V>> BPlusTree<K, V, U>::get([[maybe_unused]] const K key_
 
             // 6. "Add all keys that are equal or greater than the key 'key_from'
             //    and equal or lesser than the key 'key_to'..."
-            //    (Note: This code implements key < key_to, not <= key_to)
-            if (key >= key_from && key < key_to)
+            if (key >= key_from && key <= key_to)
             {
                 // 7. The key is in range. Add its value(s) to the set.
                 //    We must use 'if constexpr' to handle the two
@@ -242,15 +241,16 @@ std::optional<std::set<V>> BPlusTree<K, V, U>::get([[maybe_unused]] const K key_
                     values.insert(value_set.begin(), value_set.end());
                 }
             }
-            // (If key >= key_to, we just continue iterating until the
-            //  end of this leaf, as an earlier key might have been < key_to)
+            // (If key > key_to, we just continue iterating until the
+            //  end of this leaf, as an earlier key might have been <= key_to)
         }
 
         // 8. "When the last key ... matches ... take a look to the right neighbour"
         //    We check the *last key* in this leaf. If it's still less than
         //    'key_to', the range might continue. We also must check
         //    that a 'right()' neighbor actually exists.
-        if (leaf->leaf_key(leaf->size() - 1) < key_to && leaf->right() != nullptr)
+        //    Leaves emptied by removals are skipped.
+        if ((leaf->size() == 0u || leaf->leaf_key(leaf->size() - 1) < key_to) && leaf->right() != nullptr)
         {
             // 9. Move to the next leaf node to continue the scan.
             leaf = leaf->right();
@@ -267,6 +267,51 @@ std::optional<std::set<V>> BPlusTree<K, V, U>::get([[maybe_unused]] const K key_
     return values;
 }
 
+template <typename K, typename V, bool U>
+std::vector<std::pair<K, V>> BPlusTree<K, V, U>::get_ordered(const K key_from, const K key_to,
+                                                             const size_type limit) const
+{
+    std::vector<std::pair<K, V>> values;
+
+    // Walk the leaf level from the first possible key to the right,
+    // until the range or the requested number of keys is exhausted.
+    auto *leaf = this->locate_leaf(key_from);
+    auto count_keys = size_type{0u};
+    while (leaf != nullptr && count_keys < limit)
+    {
+        for (auto i = leaf->index(key_from); i < leaf->size() && count_keys < limit; i++)
+        {
+            const auto key = leaf->leaf_key(i);
+            if (key > key_to)
+            {
+                return values;
+            }
+
+            if (key >= key_from)
+            {
+                if constexpr (U)
+                {
+                    values.emplace_back(key, leaf->value(i));
+                }
+                else
+                {
+                    // Iterate a copy; sets of moved leaf entries can not be iterated in place.
+                    const auto key_values = leaf->value(i);
+                    for (const auto &value : key_values)
+                    {
+                        values.emplace_back(key, value);
+                    }
+                }
+                ++count_keys;
+            }
+        }
+
+        leaf = leaf->right();
+    }
+
+    return values;
+}
+
 template <typename K, typename V, bool U>
 BPlusTreeNode<K, V, U> *BPlusTree<K, V, U>::insert_into_leaf([[maybe_unused]] BPlusTreeNode<K, V, U> *leaf_node,
                                                              [[maybe_unused]] const K key,
@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <cstring>
 #include <index/return_value.h>
+#include <memory>
 #include <utility>
 
 namespace beedb::index::bplustree
@@ -136,6 +137,7 @@ template <typename K, typename V, bool U> class BPlusTreeNode
 
     void insert_separator(const size_type index, BPlusTreeNode<K, V, U> *separator, const K key);
     void insert_value(const size_type index, const V value, const K key);
+    void remove_value(const size_type index);
     void copy(BPlusTreeNode *other, const size_type from_index, const size_type count);
 
     std::pair<std::size_t, std::size_t> size_include_children();
@@ -230,6 +232,24 @@ void BPlusTreeNode<K, V, U>::insert_value(const size_type index, const V value,
     _header.size++;
 }
 
+template <typename K, typename V, bool U> void BPlusTreeNode<K, V, U>::remove_value(const size_type index)
+{
+    if constexpr (U == false)
+    {
+        std::destroy_at(&_leaf_node.values[index]);
+    }
+
+    const size_type offset = size() - index - 1u;
+    if (offset > 0u)
+    {
+        std::memmove(&_leaf_node.keys[index], &_leaf_node.keys[index + 1], offset * sizeof(K));
+        std::memmove(static_cast<void *>(&_leaf_node.values[index]), &_leaf_node.values[index + 1],
+                     offset * sizeof(typename ReturnValue<V, U>::type));
+    }
+
+    _header.size--;
+}
+
 template <typename K, typename V, bool U>
 void BPlusTreeNode<K, V, U>::copy(BPlusTreeNode<K, V, U> *other, const size_type from_index, const size_type count)
 {
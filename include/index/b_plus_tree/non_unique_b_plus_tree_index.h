@@ -26,6 +26,8 @@
 #include <index/index_interface.h>
 #include <index/non_unique_index_interface.h>
 #include <index/range_index_interface.h>
+#include <mutex>
+#include <shared_mutex>
 #include <storage/page.h>
 
 namespace beedb::index::bplustree
@@ -54,21 +56,46 @@ class NonUniqueBPlusTreeIndex : public IndexInterface, public NonUniqueIndexInte
 
     void put(const std::int64_t key, storage::Page::id_t page_pointer) override
     {
+        std::unique_lock _{_latch};
         _tree.put(key, page_pointer);
     }
 
+    bool remove(const std::int64_t key, storage::Page::id_t page_pointer) override
+    {
+        std::unique_lock _{_latch};
+        return _tree.remove(key, page_pointer);
+    }
+
+    [[nodiscard]] bool contains(const std::int64_t key, storage::Page::id_t page_pointer) const override
+    {
+        std::shared_lock _{_latch};
+        return _tree.contains(key, page_pointer);
+    }
+
     [[nodiscard]] std::optional<std::set<storage::Page::id_t>> get(const std::int64_t key) const override
     {
+        std::shared_lock _{_latch};
         return _tree.get(key);
     }
 
     [[nodiscard]] std::optional<std::set<storage::Page::id_t>> get(const std::int64_t key_from,
                                                                    const std::int64_t key_to) override
     {
+        std::shared_lock _{_latch};
         return _tree.get(key_from, key_to);
     }
 
+    [[nodiscard]] std::vector<std::pair<std::int64_t, storage::Page::id_t>> get_ordered(
+        const std::int64_t key_from, const std::int64_t key_to, const std::size_t limit) override
+    {
+        std::shared_lock _{_latch};
+        return _tree.get_ordered(key_from, key_to, limit);
+    }
+
   private:
     BPlusTree<std::int64_t, storage::Page::id_t, false> _tree;
+
+    // Latch for concurrent statements; lookups share the tree, modifications hold it exclusively.
+    mutable std::shared_mutex _latch;
 };
 } // namespace beedb::index::bplustree
\ No newline at end of file
@@ -56,6 +56,22 @@ class IndexInterface
      */
     virtual void put(const std::int64_t key, storage::Page::id_t page_id) = 0;
 
+    /**
+     * Removes a (Key,Page) pair from the index.
+     *
+     * @param key Key for lookups.
+     * @param page_id Value.
+     * @return True, when the pair was stored in the index.
+     */
+    virtual bool remove(const std::int64_t key, storage::Page::id_t page_id) = 0;
+
+    /**
+     * @param key Key for lookups.
+     * @param page_id Value.
+     * @return True, when the index stores the (Key,Page) pair.
+     */
+    [[nodiscard]] virtual bool contains(const std::int64_t key, storage::Page::id_t page_id) const = 0;
+
     /**
      * @return Name of the index.
      */
@@ -22,10 +22,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <set>
 #include <storage/page.h>
+#include <utility>
+#include <vector>
 
 namespace beedb::index
 {
@@ -43,10 +46,22 @@ class RangeIndexInterface
      * Lookup of a key-range.
      *
      * @param key_from From key.
-     * @param key_to To key.
+     * @param key_to To key (inclusive).
      * @return All values for the given key-range.
      */
     [[nodiscard]] virtual std::optional<std::set<storage::Page::id_t>> get(const std::int64_t key_from,
                                                                            const std::int64_t key_to) = 0;
+
+    /**
+     * Lookup of a key-range, preserving the order of keys.
+     * Used to produce rows ordered by the indexed column.
+     *
+     * @param key_from From key.
+     * @param key_to To key (inclusive).
+     * @param limit Maximal number of distinct keys to return.
+     * @return (Key, Value) pairs of the key-range, ordered by key.
+     */
+    [[nodiscard]] virtual std::vector<std::pair<std::int64_t, storage::Page::id_t>> get_ordered(
+        const std::int64_t key_from, const std::int64_t key_to, const std::size_t limit) = 0;
 };
 } // namespace beedb::index
\ No newline at end of file
@@ -23,13 +23,16 @@
 #pragma once
 #include <cstdint>
 #include <optional>
+#include <set>
 #include <storage/page.h>
 
 namespace beedb::index
 {
 /**
  * Interface for unique indices.
- * The index can store only one value per key.
+ * The key is unique among the current records; older versions of
+ * records may still hold the key on other pages, which are kept
+ * until no transaction can see those versions anymore.
  */
 class UniqueIndexInterface
 {
@@ -38,11 +41,11 @@ class UniqueIndexInterface
     virtual ~UniqueIndexInterface() = default;
 
     /**
-     * Lookup for a value for a given key.
+     * Lookup for the values of a given key.
      *
      * @param key Key to lookup.
-     * @return The stored value or an empty optional.
+     * @return The stored values or an empty optional.
      */
-    [[nodiscard]] virtual std::optional<storage::Page::id_t> get(const std::int64_t key) const = 0;
+    [[nodiscard]] virtual std::optional<std::set<storage::Page::id_t>> get(const std::int64_t key) const = 0;
 };
 } // namespace beedb::index
\ No newline at end of file
@@ -22,27 +22,51 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <io/result_output_formatter.h>
 #include <network/client.h>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <ostream>
 #include <string>
+#include <table/schema.h>
 #include <util/text_table.h>
+#include <vector>
 
 namespace beedb::io
 {
 class ClientConsole
 {
   public:
-    ClientConsole(std::string &&server, const std::uint16_t port);
+    /**
+     * @param server Name or IP of the server.
+     * @param port Port of the server.
+     * @param result_format Format of result chunks requested from the server (rows, columns, or compressed).
+     * @param output_format Format results are printed in (table, CSV, or TSV).
+     */
+    ClientConsole(std::string &&server, const std::uint16_t port, std::string &&result_format = "columns",
+                  const util::StreamingTextTable::Format output_format = util::StreamingTextTable::Table);
     ~ClientConsole() = default;
 
     void run();
 
   private:
     network::Client _client;
+    const std::string _result_format;
 
-    static bool handle_response(const std::string &response);
-    static void plan_to_table(util::TextTable &table, nlohmann::json &layer, std::uint16_t depth = 0u);
+    // Schema of the result currently streamed by the server, if any.
+    std::optional<table::Schema> _result_schema;
+
+    // Prints the rows of the result currently streamed by the server.
+    StreamingResultOutputFormatter _result_formatter;
+
+    // Buffers for decoding chunks sent column by column, reused for every chunk.
+    std::vector<std::byte> _result_columns;
+    std::vector<std::byte> _result_rows;
+
+    bool handle_response(const std::string &response);
+    static void plan_to_table(util::TextTable &table, nlohmann::json &layer, bool with_cardinality,
+                              bool with_statistics, std::uint16_t depth = 0u);
 };
 } // namespace beedb::io
\ No newline at end of file
@@ -27,9 +27,15 @@
 #include <concurrency/transaction_callback.h>
 #include <config.h>
 #include <database.h>
+#include <execution/cancellation.h>
+#include <io/client_message_serializer.h>
 #include <io/command/commander.h>
 #include <io/command/custom_commands.h>
+#include <io/executor.h>
+#include <memory>
+#include <mutex>
 #include <network/server.h>
+#include <unordered_map>
 
 namespace beedb::io
 {
@@ -41,6 +47,7 @@ class ClientHandler : public network::ClientHandler
     std::optional<std::string> handle_message(const std::uint32_t client_id, const std::string &message) override;
     void on_client_connected(const std::uint32_t id) override;
     void on_client_disconnected(const std::uint32_t id) override;
+    void on_cancel(const std::uint32_t id) override;
     void server(network::Server *server) override
     {
         network::ClientHandler::server(server);
@@ -50,7 +57,52 @@ class ClientHandler : public network::ClientHandler
   private:
     Database &_database;
     command::Commander _commander;
-    std::array<concurrency::Transaction *, Config::max_clients> _client_transactions;
+
+    /**
+     * State of a connected client.
+     */
+    struct Client
+    {
+        // Open transaction (nullptr, if none).
+        concurrency::Transaction *transaction = nullptr;
+
+        // Format of result chunks, negotiated by the client (":format <rows|columns|compressed>").
+        ResultFormat result_format = ResultFormat::Rows;
+
+        // Cancellation of the running statement, requested by the client.
+        std::unique_ptr<execution::Cancellation> cancellation = std::make_unique<execution::Cancellation>();
+    };
+
+    // State of every connected client.
+    std::unordered_map<std::uint32_t, Client> _clients;
+
+    // Latch for the clients map; every entry is only used by its client.
+    std::mutex _clients_latch;
+
+    /**
+     * @param client_id Id of the client.
+     * @return Reference to the state of the client, stable until the client disconnects.
+     */
+    Client &client(const std::uint32_t client_id)
+    {
+        std::unique_lock _{_clients_latch};
+        return _clients[client_id];
+    }
+
+    /**
+     * Sets the format of result chunks for a client.
+     *
+     * @param client Client negotiating the format.
+     * @param format Name of the format.
+     * @return Response for the client.
+     */
+    static std::string negotiate_result_format(Client &client, std::string format);
+
+    /**
+     * @param result Result of a query that produced rows.
+     * @return Response with the statistics of the query.
+     */
+    static std::string analytical_response(const ExecutionResult &result);
 };
 
 class TransactionCallback : public concurrency::TransactionCallback
@@ -24,26 +24,65 @@
 
 #include "execution_callback.h"
 #include "query_result_serializer.h"
+#include "server_response.h"
+#include <config.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <plan/logical/node/node_interface.h>
 #include <string>
+#include <table/schema.h>
+#include <vector>
 
 namespace beedb::io
 {
+/**
+ * Formats for chunks of results, negotiated by the client.
+ */
+enum class ResultFormat : std::uint8_t
+{
+    // Rows as they are (ResultRowsResponse).
+    Rows,
+
+    // Rows serialized column by column (ResultColumnsResponse).
+    Columns,
+
+    // Rows serialized column by column and compressed (ResultColumnsResponse).
+    CompressedColumns
+};
+
+/**
+ * Streams the result of a query to the client: The schema is sent
+ * as soon as it is known, rows are sent in chunks of (nearly) fixed
+ * size while the query is executed. Sending blocks until the client
+ * reads, which throttles the execution to the pace of the client.
+ */
 class ClientMessageSerializer final : public ExecutionCallback
 {
   public:
-    ClientMessageSerializer() = default;
-    ~ClientMessageSerializer() override = default;
+    using send_callback = std::function<void(const std::byte *data, std::size_t size)>;
 
-    void on_schema(const table::Schema &schema) override
+    ClientMessageSerializer(send_callback &&send, const ResultFormat result_format,
+                            const std::size_t chunk_size = Config::result_chunk_size)
+        : _send(std::move(send)), _result_format(result_format), _chunk_size(chunk_size),
+          _query_result_serializer(chunk_size)
     {
-        _query_result_serializer.serialize(schema);
     }
+    ~ClientMessageSerializer() override = default;
+
+    void on_schema(const table::Schema &schema) override;
 
     void on_tuple(const table::Tuple &tuple) override
     {
+        if (_count_chunk_rows > 0u && _query_result_serializer.size() + tuple.schema().row_size() > _chunk_size)
+        {
+            flush();
+        }
+
         _query_result_serializer.serialize(tuple);
+        ++_count_chunk_rows;
     }
 
     void on_plan(const std::unique_ptr<plan::logical::NodeInterface> &plan) override
@@ -51,13 +90,17 @@ class ClientMessageSerializer final : public ExecutionCallback
         _query_plan = plan->to_json();
     }
 
-    [[nodiscard]] const QueryResultSerializer &query_result() const
-    {
-        return _query_result_serializer;
-    }
-    [[nodiscard]] QueryResultSerializer &query_result()
+    /**
+     * Sends the rows not sent yet.
+     */
+    void flush();
+
+    /**
+     * @return True, when a result (at least the schema) was sent to the client.
+     */
+    [[nodiscard]] bool has_result() const
     {
-        return _query_result_serializer;
+        return _has_result;
     }
 
     [[nodiscard]] const nlohmann::json &query_plan() const
@@ -66,7 +109,22 @@ class ClientMessageSerializer final : public ExecutionCallback
     }
 
   private:
+    send_callback _send;
+    const ResultFormat _result_format;
+    const std::size_t _chunk_size;
+
+    // Rows of the current chunk, behind space for the response header.
     QueryResultSerializer _query_result_serializer;
+
+    // Schema of the result, needed to serialize chunks column by column.
+    std::optional<table::Schema> _schema;
+
+    // Buffers for columns and compressed columns of a chunk, reused for every chunk.
+    std::vector<std::byte> _columns;
+    std::vector<std::byte> _compressed_columns;
+
+    std::uint64_t _count_chunk_rows = 0u;
+    bool _has_result = false;
     nlohmann::json _query_plan;
 };
-} // namespace beedb::io
\ No newline at end of file
+} // namespace beedb::io
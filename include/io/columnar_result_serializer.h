@@ -0,0 +1,92 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <table/schema.h>
+#include <vector>
+
+namespace beedb::io
+{
+
+/**
+ * Chunks of rows are serialized column by column. Every column starts
+ * with its encoding (one byte), chosen by the smallest size:
+ *  - Plain: All values.
+ *  - RunLength: Number of runs (std::uint32_t), for every run the
+ *    length (std::uint32_t) and the value.
+ *  - Dictionary: Number of distinct values (std::uint32_t), the values,
+ *    and the index of every value (one byte for up to 256 distinct values, two otherwise).
+ * Values of fixed size types are written as they are; CHAR values are
+ * written by their length (std::uint16_t) and the characters, without padding.
+ */
+class ColumnarResultSerializer
+{
+  public:
+    enum Encoding : std::uint8_t
+    {
+        Plain,
+        RunLength,
+        Dictionary
+    };
+
+    /**
+     * Serializes rows column by column.
+     *
+     * @param schema Schema of the rows.
+     * @param rows Rows, serialized one after another.
+     * @param count_rows Number of rows.
+     * @param data Buffer the serialized columns are appended to.
+     */
+    static void serialize(const table::Schema &schema, const std::byte *rows, std::uint64_t count_rows,
+                          std::vector<std::byte> &data);
+
+    /**
+     * Deserializes columns into rows.
+     *
+     * @param schema Schema of the rows.
+     * @param data Serialized columns.
+     * @param count_rows Number of rows.
+     * @param rows Buffer the rows are appended to.
+     */
+    static void deserialize(const table::Schema &schema, const std::byte *data, std::uint64_t count_rows,
+                            std::vector<std::byte> &rows);
+
+  private:
+    static constexpr auto max_dictionary_size = 1u << 16u;
+
+    /**
+     * Value of a column in a row; CHAR values without padding.
+     */
+    [[nodiscard]] static std::string_view value(const table::Schema &schema, const std::byte *rows,
+                                                std::uint16_t column_index, std::uint64_t row_index);
+
+    static void write_value(std::string_view value, bool is_variable_length, std::vector<std::byte> &data);
+    static void write_integer(std::uint32_t value, std::size_t size, std::vector<std::byte> &data);
+
+    static std::string_view read_value(const std::byte *data, std::size_t &index, std::uint16_t size,
+                                       bool is_variable_length);
+    [[nodiscard]] static std::uint32_t read_integer(const std::byte *data, std::size_t &index, std::size_t size);
+};
+} // namespace beedb::io
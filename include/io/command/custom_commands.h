@@ -49,7 +49,7 @@ class ExplainCommand final : public CustomCommandInterface
                                                          ExecutionCallback &execution_callback) override;
     [[nodiscard]] std::string help() override
     {
-        return std::string("Syntax> :explain <SQL-Statement>");
+        return std::string("Syntax> :explain [analyze] <SQL-Statement>");
     };
 };
 
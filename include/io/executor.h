@@ -26,8 +26,13 @@
 #include <concurrency/transaction.h>
 #include <concurrency/transaction_callback.h>
 #include <database.h>
+#include <execution/cancellation.h>
+#include <memory>
+#include <parser/node.h>
 #include <plan/physical/plan.h>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace beedb::io
 {
@@ -41,6 +46,7 @@ struct Query
     {
         None,
         Plan,
+        Analyze,
         Graph
     };
 
@@ -60,9 +66,10 @@ class ExecutionResult
     }
 
     ExecutionResult(const std::uint64_t count_tuples, const std::chrono::milliseconds build_time,
-                    const std::chrono::milliseconds execution_time, const std::size_t evicted_pages)
+                    const std::chrono::milliseconds execution_time, const std::size_t evicted_pages,
+                    std::vector<std::pair<std::string, double>> &&performance_counters = {})
         : _is_successful(true), _count_tuples(count_tuples), _build_ms(build_time), _execution_ms(execution_time),
-          _evicted_pages(evicted_pages)
+          _evicted_pages(evicted_pages), _performance_counters(std::move(performance_counters))
     {
     }
 
@@ -98,6 +105,15 @@ class ExecutionResult
         return _count_tuples;
     }
 
+    /**
+     * @return Name and value of all performance counters measured while executing
+     *         (empty when performance counters are disabled or not available).
+     */
+    [[nodiscard]] const std::vector<std::pair<std::string, double>> &performance_counters() const
+    {
+        return _performance_counters;
+    }
+
   private:
     const bool _is_successful = false;
     const std::string _error;
@@ -105,6 +121,7 @@ class ExecutionResult
     const std::chrono::milliseconds _build_ms{};
     const std::chrono::milliseconds _execution_ms{};
     const std::size_t _evicted_pages = 0u;
+    const std::vector<std::pair<std::string, double>> _performance_counters;
 };
 
 /**
@@ -113,8 +130,15 @@ class ExecutionResult
 class Executor
 {
   public:
-    explicit Executor(Database &database, concurrency::Transaction *transaction = nullptr)
-        : _database(database), _transaction(transaction)
+    /**
+     * @param database Database to execute queries on.
+     * @param transaction Running transaction, or nullptr for starting one per query.
+     * @param cancellation Cancellation of statements (on request or by the statement timeout),
+     *                     nullptr for statements that can not be cancelled (e.g., internal ones).
+     */
+    explicit Executor(Database &database, concurrency::Transaction *transaction = nullptr,
+                      execution::Cancellation *cancellation = nullptr)
+        : _database(database), _transaction(transaction), _cancellation(cancellation)
     {
     }
 
@@ -153,5 +177,23 @@ class Executor
   protected:
     Database &_database;
     concurrency::Transaction *_transaction;
+    execution::Cancellation *_cancellation;
+
+  private:
+    /**
+     * Parses, plans, and executes a statement.
+     * @param query Statement to execute.
+     * @param execution_callback Callback receiving the result.
+     * @param transaction_callback Callback notified about started and ended transactions.
+     * @return Result of the execution.
+     */
+    ExecutionResult execute_statement(const Query &query, ExecutionCallback &execution_callback,
+                                      concurrency::TransactionCallback &transaction_callback);
+
+    /**
+     * @param ast Parsed statement.
+     * @return Table modified by the statement (insert, update, delete) or nullptr.
+     */
+    [[nodiscard]] table::Table *modified_table(const std::unique_ptr<parser::NodeInterface> &ast);
 };
 } // namespace beedb::io
@@ -40,16 +40,41 @@ namespace beedb::io
  *      - the column order index (std::uint16_t)
  *      - the null-terminated name of the column
  *  - After the schema, the bytes of the tuples will serialized.
+ *
+ * The serializer is used as a reusable buffer: Results are streamed
+ * in chunks, each starting with space reserved for a response header.
  */
 class QueryResultSerializer
 {
   public:
-    QueryResultSerializer();
+    explicit QueryResultSerializer(std::size_t capacity = 1024u);
     ~QueryResultSerializer();
 
     void serialize(const table::Schema &schema);
     void serialize(const table::Tuple &tuple);
 
+    /**
+     * Reads a serialized schema.
+     *
+     * @param data Serialized schema.
+     * @return The deserialized schema.
+     */
+    [[nodiscard]] static table::Schema deserialize(const std::byte *data);
+
+    /**
+     * Drops all serialized data.
+     *
+     * @param reserved_size Number of bytes reserved at the front, e.g., for a response header.
+     */
+    void clear(const std::size_t reserved_size = 0u)
+    {
+        if (this->_capacity < reserved_size)
+        {
+            this->allocate(reserved_size);
+        }
+        this->_size = reserved_size;
+    }
+
     [[nodiscard]] std::byte *data()
     {
         return _data;
@@ -70,7 +95,6 @@ class QueryResultSerializer
     std::size_t _capacity = 0u;
 
     void append(const std::byte *data, const std::uint16_t size);
-    void prepend(const std::byte *data, const std::uint16_t size);
 
     void allocate(const std::size_t capacity);
 };
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "execution_callback.h"
+#include <config.h>
 #include <cstddef>
 #include <cstdint>
 #include <ostream>
@@ -44,8 +45,6 @@ class ResultOutputFormatter final : public ExecutionCallback
     ResultOutputFormatter() = default;
     ~ResultOutputFormatter() override = default;
 
-    static ResultOutputFormatter from_serialized_data(const std::size_t count_tuples, const std::byte *data);
-
     void on_schema(const table::Schema &schema) override
     {
         header(schema);
@@ -78,12 +77,21 @@ class ResultOutputFormatter final : public ExecutionCallback
      */
     void push_back(const table::Tuple &tuple);
 
+    /**
+     * Add serialized tuples to the result.
+     * @param schema Schema of the tuples.
+     * @param count_tuples Number of tuples.
+     * @param data Serialized tuples.
+     */
+    void push_back(const table::Schema &schema, std::size_t count_tuples, const std::byte *data);
+
     /**
      * Clear the formatter.
      */
     inline void clear()
     {
         _table.clear();
+        _count_tuples = 0u;
     }
 
     /**
@@ -106,4 +114,107 @@ class ResultOutputFormatter final : public ExecutionCallback
     util::TextTable _table;
     std::size_t _count_tuples = 0u;
 };
+
+/**
+ * Formats the result of a query like the ResultOutputFormatter, but prints
+ * the tuples while they arrive instead of collecting the whole result.
+ */
+class StreamingResultOutputFormatter final : public ExecutionCallback
+{
+  public:
+    /**
+     * @param stream Stream the result is printed to.
+     * @param format Output format (table, CSV, or TSV).
+     * @param count_sample_rows Number of tuples used to calculate the column widths of tables;
+     *                          zero to take the widths from the schema.
+     */
+    StreamingResultOutputFormatter(std::ostream &stream, const util::StreamingTextTable::Format format,
+                                   const std::size_t count_sample_rows = Config::output_sample_rows)
+        : _table(stream, format, count_sample_rows)
+    {
+    }
+
+    ~StreamingResultOutputFormatter() override = default;
+
+    void on_schema(const table::Schema &schema) override
+    {
+        header(schema);
+    }
+    void on_tuple(const table::Tuple &tuple) override
+    {
+        push_back(tuple);
+    }
+
+    void on_plan(const std::unique_ptr<plan::logical::NodeInterface> &) override
+    {
+    }
+
+    /**
+     * Starts the output of a new result.
+     *
+     * @param schema Schema of the result.
+     */
+    void header(const table::Schema &schema);
+
+    /**
+     * Adds a single tuple to the output.
+     * @param tuple
+     */
+    void push_back(const table::Tuple &tuple);
+
+    /**
+     * Add serialized tuples to the output.
+     * @param schema Schema of the tuples.
+     * @param count_tuples Number of tuples.
+     * @param data Serialized tuples.
+     */
+    void push_back(const table::Schema &schema, std::size_t count_tuples, const std::byte *data);
+
+    /**
+     * Prints all tuples not printed yet and finishes the output.
+     */
+    void flush()
+    {
+        _table.flush();
+    }
+
+    /**
+     * Drops the output without finishing it.
+     */
+    void clear()
+    {
+        _table.clear();
+        _count_tuples = 0u;
+    }
+
+    /**
+     * @return True, when no result was started.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _table.empty();
+    }
+
+    /**
+     * @return Number of added tuples.
+     */
+    [[nodiscard]] std::size_t count() const
+    {
+        return _count_tuples;
+    }
+
+    [[nodiscard]] util::StreamingTextTable::Format format() const
+    {
+        return _table.format();
+    }
+
+  private:
+    util::StreamingTextTable _table;
+    std::size_t _count_tuples = 0u;
+
+    /**
+     * @return Printed length of the given type (at most), or zero when the length is not bounded.
+     */
+    [[nodiscard]] static std::size_t printed_length(const table::Type &type);
+};
 } // namespace beedb::io
\ No newline at end of file
@@ -21,7 +21,6 @@
  */
 
 #pragma once
-#include "query_result_serializer.h"
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -41,7 +40,10 @@ class ServerResponse
         AnalyticalResult,
         TransactionalResult,
         PlanExplanation,
-        ServerClosed
+        ServerClosed,
+        ResultSchema,
+        ResultRows,
+        ResultColumns
     };
 
     ServerResponse(const Type type, const std::uint64_t execution_time_in_ms)
@@ -104,28 +106,79 @@ class ErrorResponse final : public ServerResponse
     }
 };
 
-class AnalyticalResponse final : public ServerResponse
+/**
+ * Results of queries are streamed to the client: A ResultSchemaResponse
+ * is followed by any number of ResultRowsResponses (chunks of serialized rows)
+ * or ResultColumnsResponses, depending on the result format negotiated by the
+ * client; the AnalyticalResponse closes the result. An ErrorResponse may abort
+ * the stream after rows were sent.
+ */
+class ResultSchemaResponse final : public ServerResponse
 {
   public:
-    AnalyticalResponse(const std::uint64_t execution_time_in_ms, const std::uint64_t count_rows)
-        : ServerResponse(Type::AnalyticalResult, execution_time_in_ms), _count_rows(count_rows)
+    ResultSchemaResponse() : ServerResponse(Type::ResultSchema, 0u)
     {
     }
 
-    ~AnalyticalResponse() override = default;
+    ~ResultSchemaResponse() override = default;
+
+    [[nodiscard]] const std::byte *data() const
+    {
+        return reinterpret_cast<const std::byte *>(this + 1);
+    }
+};
+
+class ResultRowsResponse final : public ServerResponse
+{
+  public:
+    explicit ResultRowsResponse(const std::uint64_t count_rows)
+        : ServerResponse(Type::ResultRows, 0u), _count_rows(count_rows)
+    {
+    }
+
+    ~ResultRowsResponse() override = default;
 
     [[nodiscard]] std::uint64_t count_rows() const
     {
         return _count_rows;
     }
 
-    static std::string build(const std::uint64_t execution_time_in_ms, const std::uint64_t count_rows,
-                             QueryResultSerializer &&query_serializer)
+    [[nodiscard]] const std::byte *data() const
     {
-        std::string response = std::string(sizeof(AnalyticalResponse) + query_serializer.size(), '\0');
-        new (response.data()) AnalyticalResponse(execution_time_in_ms, count_rows);
-        std::memmove(response.data() + sizeof(AnalyticalResponse), query_serializer.data(), query_serializer.size());
-        return response;
+        return reinterpret_cast<const std::byte *>(this + 1);
+    }
+
+  private:
+    const std::uint64_t _count_rows;
+};
+
+/**
+ * Chunk of rows, serialized column by column (see ColumnarResultSerializer)
+ * and compressed by the util::BlockCompressor, if the uncompressed size is set.
+ */
+class ResultColumnsResponse final : public ServerResponse
+{
+  public:
+    ResultColumnsResponse(const std::uint64_t count_rows, const std::uint64_t uncompressed_size)
+        : ServerResponse(Type::ResultColumns, 0u), _count_rows(count_rows), _uncompressed_size(uncompressed_size)
+    {
+    }
+
+    ~ResultColumnsResponse() override = default;
+
+    [[nodiscard]] std::uint64_t count_rows() const
+    {
+        return _count_rows;
+    }
+
+    [[nodiscard]] bool is_compressed() const
+    {
+        return _uncompressed_size > 0u;
+    }
+
+    [[nodiscard]] std::uint64_t uncompressed_size() const
+    {
+        return _uncompressed_size;
     }
 
     [[nodiscard]] const std::byte *data() const
@@ -135,6 +188,59 @@ class AnalyticalResponse final : public ServerResponse
 
   private:
     const std::uint64_t _count_rows;
+    const std::uint64_t _uncompressed_size;
+};
+
+class AnalyticalResponse final : public ServerResponse
+{
+  public:
+    /**
+     * Hardware performance counters measured while executing the query;
+     * all zero when the counters were disabled or not available.
+     */
+    struct PerformanceCounters
+    {
+        std::uint64_t cycles;
+        std::uint64_t instructions;
+        std::uint64_t l1_misses;
+        std::uint64_t llc_misses;
+    };
+
+    AnalyticalResponse(const std::uint64_t execution_time_in_ms, const std::uint64_t count_rows,
+                       const PerformanceCounters &performance_counters)
+        : ServerResponse(Type::AnalyticalResult, execution_time_in_ms), _count_rows(count_rows),
+          _performance_counters(performance_counters)
+    {
+    }
+
+    ~AnalyticalResponse() override = default;
+
+    [[nodiscard]] std::uint64_t count_rows() const
+    {
+        return _count_rows;
+    }
+
+    [[nodiscard]] const PerformanceCounters &performance_counters() const
+    {
+        return _performance_counters;
+    }
+
+    static std::string build(const std::uint64_t execution_time_in_ms, const std::uint64_t count_rows)
+    {
+        return AnalyticalResponse::build(execution_time_in_ms, count_rows, PerformanceCounters{0u, 0u, 0u, 0u});
+    }
+
+    static std::string build(const std::uint64_t execution_time_in_ms, const std::uint64_t count_rows,
+                             const PerformanceCounters &performance_counters)
+    {
+        std::string response = std::string(sizeof(AnalyticalResponse), '\0');
+        new (response.data()) AnalyticalResponse(execution_time_in_ms, count_rows, performance_counters);
+        return response;
+    }
+
+  private:
+    const std::uint64_t _count_rows;
+    const PerformanceCounters _performance_counters;
 };
 
 class TransactionalResponse final : public ServerResponse
@@ -22,6 +22,7 @@
 
 #pragma once
 #include <cstdint>
+#include <network/frame.h>
 #include <string>
 
 namespace beedb::network
@@ -36,6 +37,28 @@ class Client
     void disconnect() const;
     std::string send(const std::string &message);
 
+    /**
+     * Sends a request without waiting for the response. Many requests
+     * can be sent in a row (pipelining); the server answers them in order,
+     * responses are read by receive().
+     * @param message Request to send.
+     * @return True, when the request was sent.
+     */
+    bool send_request(const std::string &message);
+
+    /**
+     * Reads the next message sent by the server, e.g., the response
+     * to a pipelined request or further chunks of a streamed result.
+     * @return The received message.
+     */
+    std::string receive();
+
+    /**
+     * Cancels the running request; the server responds with an error to the cancelled request.
+     * May be called from a signal handler.
+     */
+    void cancel() const;
+
     [[nodiscard]] const std::string &server() const
     {
         return _server;
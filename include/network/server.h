@@ -23,11 +23,21 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <config.h>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <network/frame.h>
 #include <optional>
 #include <string>
+#include <sys/uio.h>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace beedb::network
 {
@@ -40,6 +50,12 @@ class ClientHandler
     virtual std::optional<std::string> handle_message(const std::uint32_t client_id, const std::string &message) = 0;
     virtual void on_client_connected(const std::uint32_t id) = 0;
     virtual void on_client_disconnected(const std::uint32_t id) = 0;
+
+    /**
+     * Called by the listening thread when a client cancels its running request.
+     * @param id Id of the client.
+     */
+    virtual void on_cancel(const std::uint32_t id) = 0;
     virtual void server(Server *server)
     {
         _server = server;
@@ -55,10 +71,27 @@ class ClientHandler
     Server *_server = nullptr;
 };
 
+/**
+ * Requests and responses are framed the same way: An 8 byte length
+ * header followed by the message. Clients may send further requests
+ * without waiting for responses (pipelining); requests of a client
+ * are answered in order. A cancel frame (see frame.h) is handled
+ * immediately.
+ *
+ * The server accepts clients and reads their messages on the listening thread,
+ * waiting for events of all connections with (edge-triggered) epoll;
+ * messages are handled by a pool of worker threads. Messages of a single client
+ * are handled in order and by at most one worker at a time, so a long running
+ * query of one client does not block the other clients.
+ * Responses the socket does not take are queued per connection and sent
+ * by the listening thread, once the client read enough data. The queue
+ * is bounded: A worker streaming to a slow client blocks until the client
+ * has read enough of the queued responses.
+ */
 class Server
 {
   public:
-    Server(ClientHandler &message_handler, std::uint16_t port) noexcept;
+    Server(ClientHandler &message_handler, std::uint16_t port, std::uint16_t count_workers) noexcept;
     ~Server() noexcept = default;
 
     [[nodiscard]] std::uint16_t port() const noexcept
@@ -69,22 +102,136 @@ class Server
     {
         return _is_running;
     }
-    void stop() noexcept
-    {
-        _is_running = false;
-    }
+    void stop() noexcept;
     void send(std::uint32_t client_id, std::string &&message);
+
+    /**
+     * Sends a message to a client, prefixed by its length.
+     * The part the socket does not take is queued and sent later; while
+     * more than Config::max_queued_response_size bytes are queued, the
+     * caller waits until the client read some of them or disconnected.
+     * @param client_id Id of the client.
+     * @param message Data of the message.
+     * @param size Size of the message.
+     */
+    void send(std::uint32_t client_id, const std::byte *message, std::size_t size);
     bool listen();
 
   private:
+    /**
+     * A connected client and its messages waiting to be handled.
+     */
+    struct Connection
+    {
+        // Socket of the client.
+        std::int32_t socket = -1;
+
+        // Bytes of a request not received completely; only used by the listening thread.
+        std::string received;
+
+        // Messages received but not handled yet.
+        std::deque<std::string> messages;
+
+        // Framed responses not (completely) sent yet.
+        std::deque<std::string> responses;
+
+        // Bytes of the first response already sent.
+        std::size_t count_sent_response_bytes = 0u;
+
+        // Bytes of all queued responses not sent yet.
+        std::size_t count_queued_response_bytes = 0u;
+
+        // True, when the client is queued for or handled by a worker.
+        bool is_scheduled = false;
+
+        // True, when the client disconnected while a worker handled one of its messages.
+        bool is_closing = false;
+    };
+
+    // Event data of the listening socket and the wake up pipe; clients use their id.
+    static constexpr std::uint64_t listen_event_id = std::numeric_limits<std::uint64_t>::max();
+    static constexpr std::uint64_t wake_up_event_id = listen_event_id - 1u;
+
     const std::uint16_t _port;
+    const std::uint16_t _count_workers;
     std::int32_t _socket;
-    std::array<std::uint32_t, Config::max_clients> _client_sockets;
-    std::array<char, 512> _buffer;
+    std::int32_t _epoll;
+    std::array<char, 16384> _buffer;
     ClientHandler &_handler;
 
-    alignas(64) bool _is_running = true;
+    // Pipe to wake up the listening thread (on stop).
+    std::array<std::int32_t, 2> _wake_up_pipe{-1, -1};
+
+    // Connected clients by id.
+    std::unordered_map<std::uint32_t, Connection> _connections;
+
+    // Ids of disconnected clients, reused for new clients.
+    std::vector<std::uint32_t> _free_client_ids;
+
+    // Latch for the connections and the scheduled clients.
+    std::mutex _connections_latch;
+
+    // Clients with messages to handle, in the order the workers pick them up.
+    std::deque<std::uint32_t> _scheduled_clients;
+
+    // Notifies workers about scheduled clients.
+    std::condition_variable _scheduled_clients_condition;
+
+    // Notifies workers waiting for clients to read queued responses.
+    std::condition_variable _responses_condition;
+
+    // Threads handling messages.
+    std::vector<std::thread> _workers;
+
+    alignas(64) std::atomic_bool _is_running{true};
+
+    std::uint32_t add_client(std::int32_t client_socket);
+
+    /**
+     * Reads all bytes available on the socket of a client and schedules every complete request.
+     * @param client_id Id of the client.
+     */
+    void receive(std::uint32_t client_id);
+
+    /**
+     * Sends queued responses to a client until the socket would block.
+     * @param client_id Id of the client.
+     */
+    void flush(std::uint32_t client_id);
+
+    /**
+     * Writes the buffers to the socket until all are written or the socket would block.
+     * @param socket Socket of the client.
+     * @param buffers Buffers to write.
+     * @param count_buffers Number of buffers.
+     * @return Number of written bytes, or nothing when the client is gone.
+     */
+    static std::optional<std::size_t> send_buffers(std::int32_t socket, iovec *buffers, std::size_t count_buffers);
+
+    /**
+     * Queues a message of a client; the client is scheduled
+     * unless a worker is already handling its messages.
+     * @param client_id Id of the client.
+     * @param message Received message.
+     */
+    void schedule(std::uint32_t client_id, std::string &&message);
+
+    /**
+     * Closes the connection to a client, or defers closing
+     * until the worker handling its current message is done.
+     * @param client_id Id of the client.
+     */
+    void disconnect(std::uint32_t client_id);
+
+    /**
+     * Closes the connection to a client and frees its id.
+     * @param client_id Id of the client.
+     */
+    void close(std::uint32_t client_id);
 
-    std::uint16_t add_client(std::int32_t client_socket);
+    /**
+     * Handles scheduled messages until the server stops.
+     */
+    void work();
 };
 } // namespace beedb::network
\ No newline at end of file
@@ -213,7 +213,15 @@ class TransactionStatement final : public NodeInterface
         AbortTransaction
     };
 
-    explicit TransactionStatement(const Type type) : _type(type)
+    enum IsolationLevel
+    {
+        Serializable,
+        Snapshot
+    };
+
+    explicit TransactionStatement(const Type type, const bool is_read_only = false,
+                                  const IsolationLevel isolation_level = IsolationLevel::Serializable)
+        : _type(type), _is_read_only(is_read_only), _isolation_level(isolation_level)
     {
     }
 
@@ -231,9 +239,36 @@ class TransactionStatement final : public NodeInterface
     {
         return _type == Type::AbortTransaction;
     }
+    [[nodiscard]] bool is_read_only() const noexcept
+    {
+        return _is_read_only;
+    }
+    [[nodiscard]] IsolationLevel isolation_level() const noexcept
+    {
+        return _isolation_level;
+    }
 
   private:
     const Type _type;
+    const bool _is_read_only;
+    const IsolationLevel _isolation_level;
+};
+
+class AnalyzeStatement final : public NodeInterface
+{
+  public:
+    explicit AnalyzeStatement(std::optional<std::string> &&table_name) noexcept : _table_name(std::move(table_name))
+    {
+    }
+    ~AnalyzeStatement() noexcept override = default;
+
+    [[nodiscard]] std::optional<std::string> &table_name() noexcept
+    {
+        return _table_name;
+    }
+
+  private:
+    std::optional<std::string> _table_name;
 };
 
 class SelectQuery final : public NodeInterface
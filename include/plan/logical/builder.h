@@ -39,6 +39,7 @@ class Builder
     static std::unique_ptr<NodeInterface> build(Database &database, parser::InsertStatement *insert_statement);
     static std::unique_ptr<NodeInterface> build(Database &database, parser::UpdateStatement *update_statement);
     static std::unique_ptr<NodeInterface> build(Database &database, parser::DeleteStatement *delete_statement);
+    static std::unique_ptr<NodeInterface> build(Database &database, parser::AnalyzeStatement *analyze_statement);
     static std::unique_ptr<NodeInterface> build(Database &database,
                                                 parser::TransactionStatement *transaction_statement);
 
@@ -0,0 +1,128 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include "node/node_interface.h"
+#include "plan_view.h"
+#include <array>
+#include <database.h>
+#include <expression/operation.h>
+#include <memory>
+#include <string>
+#include <table/table.h>
+#include <unordered_map>
+
+namespace beedb::plan::logical
+{
+/**
+ * Estimates the number of rows produced by every node of a logical plan,
+ * based on the table and column statistics. Estimates of predicates are
+ * corrected by factors learned from previously executed plans.
+ */
+class CardinalityEstimator
+{
+  public:
+    explicit CardinalityEstimator(Database &database) : _database(database)
+    {
+    }
+
+    ~CardinalityEstimator() = default;
+
+    /**
+     * Annotates the nodes of the plan with their estimated cardinality.
+     *
+     * @param plan Logical plan.
+     */
+    void estimate(const std::unique_ptr<NodeInterface> &plan);
+
+    /**
+     * Annotates the nodes of a plan view with their estimated cardinality.
+     * Used while optimizing, where the children of a node are only known by the view.
+     *
+     * @param plan View on a logical plan.
+     */
+    void estimate(const PlanView &plan);
+
+    /**
+     * Compares the observed selectivity of every predicate of an executed
+     * plan to the estimated one and records the correction factor.
+     *
+     * @param plan Executed logical plan, annotated with actual cardinalities.
+     */
+    void learn(const std::unique_ptr<NodeInterface> &plan);
+
+  private:
+    /// Alias => table of all tables scanned by a (sub-)plan.
+    using TableAliases = std::unordered_map<std::string, table::Table *>;
+
+    Database &_database;
+
+    TableAliases estimate(NodeInterface *node, const PlanView *plan);
+    TableAliases learn(NodeInterface *node);
+
+    /**
+     * @param node Logical node.
+     * @param plan View on the plan, nullptr when the children of the node are set.
+     * @return Children of the node; nullptr for missing children.
+     */
+    [[nodiscard]] static std::array<NodeInterface *, 2> children(NodeInterface *node, const PlanView *plan);
+
+    /**
+     * @param node Logical node.
+     * @return Tables (by alias) scanned by the node, when the node is a scan.
+     */
+    [[nodiscard]] TableAliases scanned_tables(NodeInterface *node) const;
+
+    /**
+     * @param node Logical node.
+     * @return Predicate of selections, index scans and joins, nullptr otherwise.
+     */
+    [[nodiscard]] static const std::unique_ptr<expression::Operation> *predicate(NodeInterface *node);
+
+    /**
+     * @param node Logical node.
+     * @return Number of rows of the table, when the node is a scan.
+     */
+    [[nodiscard]] double table_cardinality(NodeInterface *node) const;
+
+    /**
+     * Estimates the selectivity of a predicate without applying learned corrections.
+     *
+     * @param predicate Predicate.
+     * @param tables Tables the predicate may reference.
+     * @return Selectivity in [0, 1].
+     */
+    [[nodiscard]] double selectivity(const std::unique_ptr<expression::Operation> &predicate,
+                                     const TableAliases &tables) const;
+
+    /**
+     * Builds the key of a predicate for the feedback store, independent
+     * of the aliases chosen by the query.
+     *
+     * @param predicate Predicate.
+     * @param tables Tables the predicate may reference.
+     * @return Signature of the predicate.
+     */
+    [[nodiscard]] static std::string signature(const std::unique_ptr<expression::Operation> &predicate,
+                                               const TableAliases &tables);
+};
+} // namespace beedb::plan::logical
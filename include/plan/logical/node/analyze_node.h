@@ -0,0 +1,61 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include "node_interface.h"
+#include <optional>
+
+namespace beedb::plan::logical
+{
+class AnalyzeNode final : public NotSchematizedNode
+{
+  public:
+    AnalyzeNode(Database &database, std::optional<std::string> &&table_name)
+        : NotSchematizedNode("Analyze"), _database(database), _table_name(std::move(table_name))
+    {
+    }
+    ~AnalyzeNode() override = default;
+
+    /**
+     * @return Name of the table to analyze; all tables will be analyzed if no name is given.
+     */
+    [[nodiscard]] const std::optional<std::string> &table_name() const
+    {
+        return _table_name;
+    }
+
+    const Schema &check_and_emit_schema(TableMap &tables) override
+    {
+        if (_table_name.has_value() && _database.table_exists(_table_name.value()) == false)
+        {
+            throw exception::TableNotFoundException(_table_name.value());
+        }
+
+        return NotSchematizedNode::check_and_emit_schema(tables);
+    }
+
+  private:
+    Database &_database;
+    std::optional<std::string> _table_name;
+};
+} // namespace beedb::plan::logical
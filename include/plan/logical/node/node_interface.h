@@ -24,11 +24,18 @@
 
 #include "schema.h"
 #include "table.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <execution/operator_statistics.h>
 #include <expression/operation.h>
 #include <memory>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <util/perf.h>
 
 namespace beedb::plan::logical
 {
@@ -56,6 +63,45 @@ class NodeInterface
     virtual const Schema &check_and_emit_schema(TableMap &tables) = 0;
     [[nodiscard]] virtual const Schema &schema() const = 0;
 
+    /**
+     * Rows the node is expected to produce; set by the cardinality estimator.
+     */
+    void estimated_cardinality(const double estimated_cardinality)
+    {
+        _estimated_cardinality = estimated_cardinality;
+    }
+    [[nodiscard]] const std::optional<double> &estimated_cardinality() const
+    {
+        return _estimated_cardinality;
+    }
+
+    /**
+     * Rows the node produced while executing; set by the physical operator
+     * once it was fully consumed.
+     */
+    [[nodiscard]] std::optional<std::uint64_t> &actual_cardinality()
+    {
+        return _actual_cardinality;
+    }
+    [[nodiscard]] const std::optional<std::uint64_t> &actual_cardinality() const
+    {
+        return _actual_cardinality;
+    }
+
+    /**
+     * Runtime statistics of the node's physical operator; recorded
+     * only for nodes that hold statistics before building the physical plan
+     * (EXPLAIN ANALYZE).
+     */
+    [[nodiscard]] std::optional<execution::OperatorStatistics> &operator_statistics()
+    {
+        return _operator_statistics;
+    }
+    [[nodiscard]] const std::optional<execution::OperatorStatistics> &operator_statistics() const
+    {
+        return _operator_statistics;
+    }
+
     [[nodiscard]] virtual nlohmann::json to_json() const
     {
         auto json = nlohmann::json{};
@@ -74,11 +120,78 @@ class NodeInterface
         schema_stream << std::flush;
         json["output"] = schema_stream.str();
 
+        if (_estimated_cardinality.has_value())
+        {
+            json["estimated_rows"] = static_cast<std::uint64_t>(std::llround(_estimated_cardinality.value()));
+        }
+        if (_actual_cardinality.has_value())
+        {
+            json["actual_rows"] = _actual_cardinality.value();
+        }
+        if (_operator_statistics.has_value())
+        {
+            const auto &statistics = _operator_statistics.value();
+            const auto time_in_ms = std::chrono::duration<double, std::milli>(statistics.time).count();
+            json["time_ms"] = time_in_ms;
+            json["exclusive_time_ms"] = time_in_ms;
+            json["rows"] = statistics.count_rows;
+            json["next_calls"] = statistics.count_next_calls;
+            json["pinned_pages"] = statistics.count_pinned_pages;
+            json["buffer_hits"] = statistics.count_buffer_hits;
+            json["buffer_misses"] = statistics.count_buffer_misses;
+            json["peak_memory_bytes"] = statistics.peak_memory;
+
+            for (const auto &[name, value] : statistics.performance_counters)
+            {
+                json["performance_counters"][name] = static_cast<std::uint64_t>(std::llround(value));
+            }
+            if (json.contains("performance_counters"))
+            {
+                const auto &counters = json["performance_counters"];
+                const auto &cycles_name = util::Perf::CYCLES.name();
+                const auto &instructions_name = util::Perf::INSTRUCTIONS.name();
+                if (counters.contains(cycles_name) && counters.contains(instructions_name) &&
+                    counters[cycles_name].get<std::uint64_t>() > 0u)
+                {
+                    json["ipc"] = static_cast<double>(counters[instructions_name].get<std::uint64_t>()) /
+                                  static_cast<double>(counters[cycles_name].get<std::uint64_t>());
+                }
+            }
+        }
+
         return json;
     }
 
+  protected:
+    /**
+     * Subtracts the time of the children from the (inclusive) time of
+     * the node; the node's JSON has to contain the children's JSON.
+     *
+     * @param json JSON of the node.
+     */
+    static void exclusive_time(nlohmann::json &json)
+    {
+        if (json.contains("exclusive_time_ms") == false)
+        {
+            return;
+        }
+
+        auto exclusive_time_in_ms = json["time_ms"].get<double>();
+        for (const auto &child : json["childs"])
+        {
+            if (child.contains("time_ms"))
+            {
+                exclusive_time_in_ms -= child["time_ms"].get<double>();
+            }
+        }
+        json["exclusive_time_ms"] = std::max(0.0, exclusive_time_in_ms);
+    }
+
   private:
     std::string _name;
+    std::optional<double> _estimated_cardinality;
+    std::optional<std::uint64_t> _actual_cardinality;
+    std::optional<execution::OperatorStatistics> _operator_statistics;
 };
 
 class UnaryNode : public NodeInterface
@@ -112,6 +225,7 @@ class UnaryNode : public NodeInterface
     {
         auto json = NodeInterface::to_json();
         json["childs"][0] = _child->to_json();
+        NodeInterface::exclusive_time(json);
         return json;
     }
 
@@ -165,6 +279,7 @@ class BinaryNode : public NodeInterface
         auto json = NodeInterface::to_json();
         json["childs"][0] = _left_child->to_json();
         json["childs"][1] = _right_child->to_json();
+        NodeInterface::exclusive_time(json);
         return json;
     }
 
@@ -26,6 +26,7 @@
 #include "schema.h"
 #include "table.h"
 #include <database.h>
+#include <optional>
 
 namespace beedb::plan::logical
 {
@@ -86,12 +87,28 @@ class TableScanNode final : public NodeInterface
 class IndexScanNode final : public NodeInterface
 {
   public:
-    IndexScanNode(Database &database, TableReference &&table_reference, expression::Attribute &&attribute,
+    IndexScanNode(Database &database, TableReference &&table_reference,
                   std::unique_ptr<expression::Operation> &&predicate)
         : NodeInterface("Index Scan"), _database(database), _table_reference(std::move(table_reference)),
-          _attribute(std::move(attribute)), _predicate(std::move(predicate))
+          _predicate(std::move(predicate))
     {
     }
+
+    /**
+     * Creates an index scan producing rows ordered by the given attribute.
+     *
+     * @param database Database.
+     * @param table_reference Scanned table.
+     * @param order Attribute with a range index, the rows will be ordered by.
+     * @param predicate Predicate on the order attribute limiting the scanned range; may be nullptr.
+     */
+    IndexScanNode(Database &database, TableReference &&table_reference, expression::Attribute &&order,
+                  std::unique_ptr<expression::Operation> &&predicate)
+        : NodeInterface("Index Scan"), _database(database), _table_reference(std::move(table_reference)),
+          _order(std::move(order)), _predicate(std::move(predicate))
+    {
+    }
+
     ~IndexScanNode() override = default;
 
     const Schema &check_and_emit_schema(TableMap &tables) override
@@ -105,8 +122,14 @@ class IndexScanNode final : public NodeInterface
         auto *table = _database.table(_table_reference.table_name());
         tables.insert(table, _table_reference.table_name());
 
-        tables.check_and_replace_table(_predicate);
-        tables.check_and_replace_table(_attribute);
+        if (_predicate != nullptr)
+        {
+            tables.check_and_replace_table(_predicate);
+        }
+        if (_order.has_value())
+        {
+            tables.check_and_replace_table(_order.value());
+        }
 
         _schema.reserve(table->schema().size());
         for (const auto &term : table->schema().terms())
@@ -130,9 +153,9 @@ class IndexScanNode final : public NodeInterface
     {
         return _predicate;
     }
-    [[nodiscard]] const expression::Attribute &attribute() const
+    [[nodiscard]] const std::optional<expression::Attribute> &order() const
     {
-        return _attribute;
+        return _order;
     }
 
     void schema(const Schema &schema)
@@ -141,10 +164,26 @@ class IndexScanNode final : public NodeInterface
         std::copy(schema.begin(), schema.end(), std::back_inserter(_schema));
     }
 
+    [[nodiscard]] nlohmann::json to_json() const override
+    {
+        auto json = NodeInterface::to_json();
+        auto data = _table_reference.table_name();
+        if (_order.has_value())
+        {
+            data += " ordered by " + static_cast<std::string>(_order.value());
+        }
+        if (_predicate != nullptr)
+        {
+            data += " " + static_cast<std::string>(_predicate->result().value());
+        }
+        json["data"] = std::move(data);
+        return json;
+    }
+
   private:
     Database &_database;
     TableReference _table_reference;
-    expression::Attribute _attribute;
+    std::optional<expression::Attribute> _order;
     std::unique_ptr<expression::Operation> _predicate;
     Schema _schema;
 };
@@ -23,16 +23,33 @@
 #pragma once
 
 #include "node_interface.h"
+#include <concurrency/transaction.h>
 
 namespace beedb::plan::logical
 {
 class BeginTransactionNode final : public NotSchematizedNode
 {
   public:
-    BeginTransactionNode() : NotSchematizedNode("Begin Transaction")
+    BeginTransactionNode(const bool is_read_only, const concurrency::IsolationLevel isolation_level)
+        : NotSchematizedNode(is_read_only ? "Begin Read Only Transaction" : "Begin Transaction"),
+          _is_read_only(is_read_only), _isolation_level(isolation_level)
     {
     }
     ~BeginTransactionNode() override = default;
+
+    [[nodiscard]] bool is_read_only() const
+    {
+        return _is_read_only;
+    }
+
+    [[nodiscard]] concurrency::IsolationLevel isolation_level() const
+    {
+        return _isolation_level;
+    }
+
+  private:
+    const bool _is_read_only;
+    const concurrency::IsolationLevel _isolation_level;
 };
 
 class CommitTransactionNode final : public NotSchematizedNode
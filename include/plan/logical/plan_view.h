@@ -50,6 +50,14 @@ class PlanView
     [[nodiscard]] bool move_between(node_t node, node_t child_node, node_t node_to_move);
     void erase(node_t node);
 
+    /**
+     * Inserts a new unary node as the parent of the given node.
+     *
+     * @param node Node that will be the child of the new node.
+     * @param node_to_insert New unary node.
+     */
+    void insert_above(node_t node, node_t node_to_insert);
+
     [[nodiscard]] bool has_child(node_t node) const
     {
         return _node_children.find(node) != _node_children.end() && _node_children.at(node)[0] != nullptr;
@@ -0,0 +1,78 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include <database.h>
+#include <plan/logical/cardinality_estimator.h>
+#include <plan/logical/plan_view.h>
+
+namespace beedb::plan::logical
+{
+/**
+ * Estimates the costs of executing a (view on a) logical plan, based on
+ * the estimated cardinalities of all nodes. Costs are measured in units
+ * of one sequentially scanned row.
+ */
+class CostModel
+{
+  public:
+    explicit CostModel(Database &database) : _cardinality_estimator(database)
+    {
+    }
+
+    ~CostModel() = default;
+
+    /**
+     * Annotates the nodes of the plan with estimated cardinalities and
+     * sums up the costs of all nodes.
+     *
+     * @param plan View on a logical plan.
+     * @return Estimated costs of the plan.
+     */
+    [[nodiscard]] double cost(const PlanView &plan);
+
+  private:
+    /// Costs for reading a row by a sequential scan.
+    static constexpr auto sequential_row_cost = 1.0;
+
+    /// Costs for reading a row through an index; pages are fetched randomly.
+    static constexpr auto index_row_cost = 2.0;
+
+    /// Costs for evaluating a predicate or an expression on a single row.
+    static constexpr auto cpu_row_cost = 0.1;
+
+    /// Costs for inserting a row into or probing a hash table.
+    static constexpr auto hash_row_cost = 0.25;
+
+    CardinalityEstimator _cardinality_estimator;
+
+    [[nodiscard]] static double cost(const PlanView &plan, NodeInterface *node);
+
+    /**
+     * @param plan View on a logical plan.
+     * @param node Root of the sub-plan.
+     * @return True, when the sub-plan produces rows without consuming all its input first.
+     */
+    [[nodiscard]] static bool is_pipelined(const PlanView &plan, NodeInterface *node);
+};
+} // namespace beedb::plan::logical
@@ -0,0 +1,129 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include "cost_model.h"
+#include <cstdint>
+#include <expression/operation.h>
+#include <memory>
+#include <optional>
+#include <plan/logical/node/node_interface.h>
+#include <plan/logical/plan_view.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace beedb::plan::logical
+{
+/**
+ * The memo stores all equivalent alternatives of a plan found while
+ * exploring the search space. Alternatives share unchanged nodes, two
+ * alternatives are the same when their fingerprints (built from the
+ * content of all nodes) are equal, regardless of the order of rules
+ * that produced them. Each alternative is costed once on insertion;
+ * alternatives much more expensive than the best known are pruned.
+ *
+ * Nodes created by rules while exploring are owned by the memo until
+ * the chosen plan is released.
+ */
+class Memo
+{
+  public:
+    Memo(CostModel &cost_model, std::size_t capacity, const PlanView &plan);
+    ~Memo() = default;
+
+    /**
+     * Adds an alternative to the memo, when it was not seen before.
+     *
+     * @param plan Alternative plan.
+     * @return True, when the alternative is new.
+     */
+    bool insert(PlanView &&plan);
+
+    /**
+     * Picks the cheapest alternative, that was not explored yet.
+     *
+     * @return Alternative to explore or std::nullopt, when the search is finished.
+     */
+    [[nodiscard]] std::optional<PlanView> next();
+
+    /**
+     * @return True, when an alternative is cheaper than the initial plan.
+     */
+    [[nodiscard]] bool has_improved() const
+    {
+        return _best_index != 0u;
+    }
+
+    /**
+     * Hands over all nodes of the cheapest alternative; the caller
+     * takes the ownership of nodes created by rules.
+     *
+     * @return The cheapest alternative.
+     */
+    [[nodiscard]] PlanView release_best();
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return _alternatives.size();
+    }
+
+  private:
+    /// Alternatives costing more than this factor times the best costs are not explored.
+    static constexpr auto prune_factor = 8.0;
+
+    struct Alternative
+    {
+        Alternative(PlanView &&plan_, const double cost_) : plan(std::move(plan_)), cost(cost_)
+        {
+        }
+
+        PlanView plan;
+        double cost;
+        bool is_explored = false;
+    };
+
+    CostModel &_cost_model;
+    const std::size_t _capacity;
+    std::vector<Alternative> _alternatives;
+    std::size_t _best_index = 0u;
+    std::unordered_set<std::string> _fingerprints;
+
+    /// Nodes of the initial plan, owned by the plan itself.
+    std::unordered_set<PlanView::node_t> _plan_nodes;
+
+    /// Nodes created by rules.
+    std::unordered_map<PlanView::node_t, std::unique_ptr<NodeInterface>> _created_nodes;
+
+    /**
+     * Takes the ownership of all nodes, the memo has not seen before.
+     *
+     * @param plan Alternative plan.
+     */
+    void adopt_nodes(const PlanView &plan);
+
+    [[nodiscard]] static std::string fingerprint(const PlanView &plan, PlanView::node_t node);
+    [[nodiscard]] static std::string fingerprint(const std::unique_ptr<expression::Operation> &operation);
+};
+} // namespace beedb::plan::logical
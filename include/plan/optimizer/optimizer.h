@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "cost_model.h"
 #include <database.h>
 #include <memory>
 #include <plan/logical/node/node_interface.h>
@@ -44,13 +45,54 @@ class Optimizer
         return optimize(std::move(logical_plan));
     }
 
+    /**
+     * Adds a rule that is applied to a fixpoint, in order of registration,
+     * before the transformations are explored. Used for normalizations
+     * that never make the plan worse.
+     *
+     * @param rule Rule.
+     */
     void add(std::unique_ptr<OptimizerRuleInterface> &&rule)
     {
         _rules.emplace_back(std::move(rule));
     }
 
+    /**
+     * Adds a rule that is used as transformation while exploring the
+     * search space. Every transformation is tried on every explored
+     * alternative, the cheapest alternative wins; the order of
+     * registration does not matter.
+     *
+     * @param rule Rule.
+     */
+    void add_transformation(std::unique_ptr<OptimizerRuleInterface> &&rule)
+    {
+        _transformations.emplace_back(std::move(rule));
+    }
+
+    /**
+     * Sets the cost model that is used to compare alternatives while exploring.
+     *
+     * @param cost_model Cost model.
+     */
+    void cost_model(std::unique_ptr<CostModel> &&cost_model)
+    {
+        _cost_model = std::move(cost_model);
+    }
+
   private:
     std::vector<std::unique_ptr<OptimizerRuleInterface>> _rules;
+    std::vector<std::unique_ptr<OptimizerRuleInterface>> _transformations;
+    std::unique_ptr<CostModel> _cost_model;
+
+    /**
+     * Explores alternatives of the plan using all transformations and
+     * replaces the plan with the cheapest one.
+     *
+     * @param plan_view Plan to optimize; will be replaced by the cheapest alternative.
+     * @return True, when a cheaper alternative was found.
+     */
+    bool explore(PlanView &plan_view);
 
     static std::unique_ptr<NodeInterface> commit(PlanView &&plan_view, std::unique_ptr<NodeInterface> &&plan);
     static std::unique_ptr<NodeInterface> commit(
@@ -0,0 +1,57 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include <expression/attribute.h>
+#include <optional>
+#include <plan/logical/plan_view.h>
+
+namespace beedb::plan::logical
+{
+/**
+ * Derives physical properties of the rows produced by (a view on) a plan.
+ * Currently, the only tracked property is the (ascending) sort order.
+ */
+class PhysicalProperties
+{
+  public:
+    /**
+     * @param plan View on a logical plan.
+     * @param node Node of the plan.
+     * @return Attribute the rows produced by the node are ordered by (ascending), std::nullopt when unordered.
+     */
+    [[nodiscard]] static std::optional<expression::Attribute> order(const PlanView &plan, PlanView::node_t node);
+
+    /**
+     * @param node Logical node.
+     * @return True, when the node emits rows in the order produced by its child.
+     */
+    [[nodiscard]] static bool preserves_order(PlanView::node_t node);
+
+    /**
+     * @param node Logical node.
+     * @return The attribute the node requires rows to be ordered by (ascending), std::nullopt for none.
+     */
+    [[nodiscard]] static std::optional<expression::Attribute> required_order(PlanView::node_t node);
+};
+} // namespace beedb::plan::logical
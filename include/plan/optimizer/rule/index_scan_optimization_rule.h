@@ -25,9 +25,7 @@
 #include <database.h>
 #include <expression/operation.h>
 #include <memory>
-#include <optional>
 #include <string>
-#include <utility>
 
 namespace beedb::plan::logical
 {
@@ -43,7 +41,17 @@ class IndexScanOptimizationRule : public OptimizerRuleInterface
 
   private:
     Database &_database;
-    std::pair<std::optional<expression::Attribute>, std::unique_ptr<expression::Operation>> find_index_predicate(
+
+    /**
+     * Extracts the part of the predicate that can be answered by one or more indices.
+     * Conjunctions keep every indexable side (their page ids are intersected),
+     * disjunctions are only indexable when both sides are (their page ids are united).
+     *
+     * @param table_name Name of the scanned table.
+     * @param predicate Selection predicate.
+     * @return Indexable predicate or nullptr, when no index can be used.
+     */
+    std::unique_ptr<expression::Operation> find_index_predicate(
         const std::string &table_name, const std::unique_ptr<expression::Operation> &predicate);
 };
 } // namespace beedb::plan::logical
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include "optimizer_rule_interface.h"
+#include <database.h>
+#include <expression/attribute.h>
+#include <expression/operation.h>
+#include <memory>
+
+namespace beedb::plan::logical
+{
+/**
+ * Removes ORDER BY nodes, when the rows are already produced in the
+ * required order. When a scan below an ORDER BY reads a table that
+ * has a range index on the ordering attribute, the scan is replaced
+ * by an ordered index scan and the ORDER BY is removed; the cost model
+ * decides whether that is cheaper than sorting.
+ */
+class InterestingOrderOptimizationRule final : public OptimizerRuleInterface
+{
+  public:
+    explicit InterestingOrderOptimizationRule(Database &database) : _database(database)
+    {
+    }
+    ~InterestingOrderOptimizationRule() override = default;
+
+    bool optimize(PlanView &plan) override;
+
+  private:
+    Database &_database;
+
+    /**
+     * Creates an ordered index scan replacing the given scan.
+     *
+     * @param scan Table scan or (unordered) index scan.
+     * @param order Attribute the rows have to be ordered by.
+     * @return Ordered index scan or nullptr, when no range index exists for the attribute.
+     */
+    [[nodiscard]] NodeInterface *build_ordered_scan(PlanView::node_t scan, const expression::Attribute &order);
+
+    /**
+     * Extracts the comparisons of the predicate on the ordering attribute, that
+     * limit the range of the ordered scan.
+     *
+     * @param predicate Predicate of an index scan.
+     * @param order Attribute the rows will be ordered by.
+     * @return Predicate on the ordering attribute or nullptr, when the range is not limited.
+     */
+    [[nodiscard]] static std::unique_ptr<expression::Operation> range_predicate(
+        const std::unique_ptr<expression::Operation> &predicate, const expression::Attribute &order);
+};
+} // namespace beedb::plan::logical
@@ -0,0 +1,101 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include "optimizer_rule_interface.h"
+#include <expression/operation.h>
+#include <expression/term.h>
+#include <memory>
+#include <optional>
+#include <variant>
+#include <vector>
+
+namespace beedb::plan::logical
+{
+/**
+ * Simplifies the predicates of selections: Constant sub-expressions
+ * are folded, tautologies (e.g. "1 = 1") are removed, and range
+ * predicates on the same column are merged into a single interval
+ * (e.g. "x > 5 AND x > 3" to "x > 5"). Selections that can never
+ * be true produce an empty result without executing the plan.
+ */
+class PredicateSimplificationOptimizationRule final : public OptimizerRuleInterface
+{
+  public:
+    PredicateSimplificationOptimizationRule() = default;
+    ~PredicateSimplificationOptimizationRule() override = default;
+
+    bool optimize(PlanView &plan) override;
+
+  private:
+    /// A simplified predicate is either a predicate or a constant truth value.
+    using SimplifiedPredicate = std::variant<std::unique_ptr<expression::Operation>, bool>;
+
+    /**
+     * Simplifies the given predicate.
+     *
+     * @param predicate Predicate to simplify.
+     * @param is_simplified Will be set to true, when the predicate was simplified.
+     * @return Simplified predicate or its constant truth value.
+     */
+    [[nodiscard]] static SimplifiedPredicate simplify(const std::unique_ptr<expression::Operation> &predicate,
+                                                      bool &is_simplified);
+
+    /**
+     * Folds constant arithmetic sub-expressions of an operand (e.g. "2 * 3" to "6").
+     *
+     * @param operand Operand of a comparison.
+     * @param is_folded Will be set to true, when a sub-expression was folded.
+     * @return Folded operand.
+     */
+    [[nodiscard]] static std::unique_ptr<expression::Operation> fold(
+        const std::unique_ptr<expression::Operation> &operand, bool &is_folded);
+
+    /**
+     * Merges comparisons of the same attribute to numeric values into intervals.
+     *
+     * @param conjuncts Predicates combined by AND.
+     * @param is_simplified Will be set to true, when comparisons were merged.
+     * @return Merged conjuncts or std::nullopt, when the conjuncts contradict.
+     */
+    [[nodiscard]] static std::optional<std::vector<std::unique_ptr<expression::Operation>>> merge_ranges(
+        std::vector<std::unique_ptr<expression::Operation>> &&conjuncts, bool &is_simplified);
+
+    /**
+     * Compares two constant terms.
+     *
+     * @return Negative, zero, or positive when the left term is lesser, equal,
+     *  or greater than the right one; std::nullopt if the terms are not comparable.
+     */
+    [[nodiscard]] static std::optional<std::int32_t> compare(const expression::Term &left,
+                                                             const expression::Term &right);
+
+    [[nodiscard]] static bool is_numeric(const expression::Term &term);
+
+    [[nodiscard]] static std::unique_ptr<expression::BinaryOperation> make_operation(
+        expression::Operation::Type type, std::unique_ptr<expression::Operation> &&left_child,
+        std::unique_ptr<expression::Operation> &&right_child);
+
+    [[nodiscard]] static bool is_below_empty_result(const PlanView &plan, PlanView::node_t node);
+};
+} // namespace beedb::plan::logical
@@ -71,6 +71,8 @@ class Builder
   private:
     /**
      * Builds a physical execution operator based on a logical node.
+     * Operators of nodes with an estimated cardinality record their
+     * actual cardinality, operators of analyzed nodes their runtime statistics.
      *
      * @param database Database for execution.
      * @param transaction Transaction for execution.
@@ -83,6 +85,20 @@ class Builder
         concurrency::TransactionCallback &transaction_callback, bool add_to_scan_set,
         concurrency::ScanSetItem *scan_set, const std::unique_ptr<logical::NodeInterface> &logical_node);
 
+    /**
+     * Builds the physical execution operator for a logical node,
+     * without recording its cardinality or runtime statistics.
+     *
+     * @param database Database for execution.
+     * @param transaction Transaction for execution.
+     * @param logical_node Logical node.
+     * @return Pointer to the built physical operator.
+     */
+    static std::unique_ptr<execution::OperatorInterface> build_node_operator(
+        Database &database, concurrency::Transaction *transaction,
+        concurrency::TransactionCallback &transaction_callback, bool add_to_scan_set,
+        concurrency::ScanSetItem *scan_set, const std::unique_ptr<logical::NodeInterface> &logical_node);
+
     /**
      * Turns a logical predicate into a physical predicate matcher.
      *
@@ -142,11 +158,39 @@ class Builder
      * Extracts key ranges for index scans from a logical predicate.
      *
      * @param predicate Logical predicate.
-     * @return Set of key ranges the index scan has to lookup.
+     * @return Set of key ranges the index scan has to lookup; empty, when no range
+     *         could be extracted (e.g. comparisons with non-integer values).
      */
     static std::unordered_set<execution::KeyRange> extract_key_ranges(
         const std::unique_ptr<expression::Operation> &predicate);
 
+    /**
+     * Builds an index scan producing rows ordered by the given attribute.
+     *
+     * @param database Database.
+     * @param transaction Transaction.
+     * @param table Scanned table.
+     * @param schema Schema of the scan.
+     * @param order Attribute the rows are ordered by.
+     * @param predicate Predicate on the ordering attribute limiting the key range; may be nullptr.
+     * @return Ordered index scan, or a sorted sequential scan when the index is missing.
+     */
+    static std::unique_ptr<execution::OperatorInterface> build_ordered_index_scan(
+        Database &database, concurrency::Transaction *transaction, table::Table &table, table::Schema &&schema,
+        const expression::Attribute &order, const std::unique_ptr<expression::Operation> &predicate);
+
+    /**
+     * Builds a tree of index lookups from the predicate of an index scan.
+     * Conjunctions are resolved by intersecting, disjunctions by uniting
+     * the page ids of the underlying index probes.
+     *
+     * @param predicate Predicate of the index scan.
+     * @param schema Schema of the scanned table, holding the indices.
+     * @return Lookup tree or nullptr, when the predicate can not be answered by indices.
+     */
+    static std::unique_ptr<execution::IndexLookup> build_index_lookup(
+        const std::unique_ptr<expression::Operation> &predicate, const table::Schema &schema);
+
     /**
      * Extracts a key from a logical atom.
      * @param atom Logical atom.
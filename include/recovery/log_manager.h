@@ -0,0 +1,194 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include "log_record.h"
+#include <concurrency/timestamp.h>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace beedb::recovery
+{
+/**
+ * The LogManager appends log records to the write-ahead log and makes
+ * them durable. Records are collected in memory and written on flush.
+ *
+ * Concurrent flushes are grouped (group commit): The first thread that
+ * requests a flush becomes the leader and writes everything appended so far
+ * with a single sync; threads arriving meanwhile keep appending and wait
+ * until the leader is done. The next waiting thread whose records are still
+ * not durable leads the following group.
+ *
+ * While appending, the LogManager tracks the active transactions (those
+ * that logged modifications but did not commit or abort yet) for checkpoints.
+ *
+ * Records are addressed by their offset in the log file (LSN). Once a checkpoint
+ * is durable, the records recovery will not read again are freed by punching
+ * a hole into the file; the offsets of the following records stay valid.
+ */
+class LogManager
+{
+  public:
+    explicit LogManager(const std::string &file_name);
+    ~LogManager();
+
+    /**
+     * Appends a record to the log. The record is not durable until
+     * the log is flushed up to the returned LSN.
+     *
+     * @param record Record to append.
+     * @return LSN of the appended record.
+     */
+    lsn_t append(const LogRecord &record);
+
+    /**
+     * Appends a checkpoint record, holding the given dirty pages and
+     * the transactions active at the time the record is appended.
+     *
+     * @param begin_lsn End of the log when the checkpoint started.
+     * @param dirty_pages Dirty pages with the LSN of their first unwritten change.
+     * @return LSN of the checkpoint record.
+     */
+    lsn_t append_checkpoint(lsn_t begin_lsn, const std::vector<std::pair<storage::Page::id_t, lsn_t>> &dirty_pages);
+
+    /**
+     * Frees the records that are not needed to recover from the given checkpoint:
+     * Those logged before the checkpoint started, before the first unwritten change of
+     * any dirty page, and before the first record of any active transaction.
+     * The checkpoint has to be the latest one and registered as such (e.g., in the metadata).
+     *
+     * @param checkpoint_lsn LSN of the checkpoint record.
+     */
+    void truncate(lsn_t checkpoint_lsn);
+
+    /**
+     * Discards all records, leaving only the header; used when the log
+     * belongs to a data file that does not exist anymore. No other
+     * thread may use the log meanwhile.
+     */
+    void clear();
+
+    /**
+     * Makes the log durable up to (and including) the record with the given LSN;
+     * blocks until the record is written and synced. After a write failed,
+     * no record is made durable anymore and every flush throws.
+     *
+     * @param lsn LSN to flush.
+     */
+    void flush(lsn_t lsn);
+
+    /**
+     * Makes all appended records durable.
+     */
+    void flush();
+
+    /**
+     * Reads all durable records, beginning at the given LSN.
+     * The log ends with the first incomplete or corrupted record,
+     * which is left by a crash while writing; the log is truncated there.
+     *
+     * @param lsn LSN of the first record to read.
+     * @return List of LSNs and records.
+     */
+    std::vector<std::pair<lsn_t, LogRecord>> read(lsn_t lsn);
+
+    /**
+     * @return LSN of the first record in the log.
+     */
+    [[nodiscard]] static lsn_t begin_lsn()
+    {
+        return sizeof(MAGIC);
+    }
+
+    /**
+     * @return LSN the next appended record will get.
+     */
+    [[nodiscard]] lsn_t next_lsn()
+    {
+        std::lock_guard _{_latch};
+        return _next_lsn;
+    }
+
+    /**
+     * @return Number of syncs issued, each covering a group of commits.
+     */
+    [[nodiscard]] std::size_t count_syncs()
+    {
+        std::lock_guard _{_latch};
+        return _count_syncs;
+    }
+
+  private:
+    // Header at the beginning of every log file.
+    static constexpr char MAGIC[8] = {'B', 'E', 'E', 'D', 'B', 'W', 'A', 'L'};
+
+    // Name of the log file.
+    const std::string _file_name;
+
+    // Descriptor of the log file, opened for appending.
+    int _file_descriptor;
+
+    // Records appended but not yet handed to a flush.
+    std::vector<std::byte> _buffer;
+
+    // Records written by the current flush leader; swapped with the buffer to reuse memory.
+    std::vector<std::byte> _flush_buffer;
+
+    // LSN of the next record.
+    lsn_t _next_lsn = 0u;
+
+    // End of the durable log; all records below are durable.
+    lsn_t _flushed_lsn = 0u;
+
+    // True, while a leader writes a group.
+    bool _is_flushing = false;
+
+    // True, after writing a group failed; records that are not durable will never be.
+    bool _is_failed = false;
+
+    std::size_t _count_syncs = 0u;
+
+    // Transactions with logged modifications that did not end yet, with the LSN of their first record.
+    std::unordered_map<concurrency::timestamp::timestamp_t, lsn_t> _active_transactions;
+
+    // LSN of the latest checkpoint and the first LSN recovering from that checkpoint reads.
+    std::pair<lsn_t, lsn_t> _checkpoint{0u, 0u};
+
+    // All records below are freed.
+    lsn_t _truncated_lsn = 0u;
+
+    std::mutex _latch;
+    std::condition_variable _flushed_condition;
+
+    /**
+     * Writes the data to the log file and syncs the file.
+     *
+     * @param data Data to write.
+     */
+    void write(const std::vector<std::byte> &data);
+};
+} // namespace beedb::recovery
@@ -0,0 +1,450 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include <concurrency/timestamp.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <storage/page.h>
+#include <storage/record_identifier.h>
+#include <utility>
+#include <vector>
+
+namespace beedb::recovery
+{
+/**
+ * Log sequence numbers are byte offsets of records in the log.
+ * The log starts with a file header, the LSN 0 never names a record.
+ */
+using lsn_t = std::uint64_t;
+
+/**
+ * A log record describes a single record-level change, the end of a
+ * transaction, or a checkpoint. On disk, a record is a fixed-size header
+ * followed by a variable-sized image.
+ *
+ *  - Insert, Update, and Delete are written when a transaction modifies a
+ *    record and carry what is needed to undo the modification; updates
+ *    carry the before-image of the record.
+ *  - Write records carry the after-image of a record stamped by a commit
+ *    and are redone for committed transactions only.
+ *  - Compensation records carry the after-image of a record restored by
+ *    an abort (or no image, when the slot was freed) and are always redone.
+ *  - Checkpoint records carry the dirty pages and active transactions.
+ *
+ * Images always cover the full record, including the concurrency metadata.
+ */
+class LogRecord
+{
+  public:
+    enum Type : std::uint8_t
+    {
+        Insert,
+        Update,
+        Delete,
+        Write,
+        Compensation,
+        Commit,
+        Abort,
+        Checkpoint
+    };
+
+    /**
+     * Header of every record in the log.
+     */
+    struct Header
+    {
+        // Size of the record, including the header.
+        std::uint32_t size;
+
+        // Checksum over header and image to detect torn writes.
+        std::uint32_t checksum;
+
+        Type type;
+
+        // Begin time of the transaction, identifying the transaction.
+        concurrency::timestamp::timestamp_t transaction;
+
+        // Commit time of the transaction (Write and Commit records).
+        concurrency::timestamp::timestamp_t commit_timestamp;
+
+        // Slot of the modified record.
+        storage::Page::id_t page_id;
+        std::uint16_t slot;
+        storage::Page::offset_t slot_start;
+
+        // Slot of the versioned record (Update records).
+        storage::Page::id_t old_page_id;
+        std::uint16_t old_slot;
+    };
+
+    /**
+     * Creates a record that allows to undo an uncommitted insert, update, or delete.
+     *
+     * @param type Insert, Update, or Delete.
+     * @param transaction Begin time of the modifying transaction.
+     * @param record_identifier Modified record.
+     * @param old_record_identifier Versioned record in the time travel space (updates only).
+     * @param before_image Data of the record before the update (updates only).
+     * @param size Size of the before-image.
+     * @return Log record.
+     */
+    static LogRecord make_modification(const Type type, const concurrency::timestamp::timestamp_t transaction,
+                                       const storage::RecordIdentifier record_identifier,
+                                       const storage::RecordIdentifier old_record_identifier,
+                                       const std::byte *before_image = nullptr, const std::uint16_t size = 0u)
+    {
+        auto record = LogRecord{type, transaction};
+        record.record_identifier(record_identifier);
+        record._header.old_page_id = old_record_identifier.page_id();
+        record._header.old_slot = old_record_identifier.slot();
+        record.image(before_image, size);
+        return record;
+    }
+
+    /**
+     * Creates a record that logs the image of a record stamped by a commit.
+     *
+     * @param transaction Begin time of the committing transaction.
+     * @param commit_timestamp Commit time of the transaction.
+     * @param record_identifier Slot of the written record.
+     * @param slot_start Offset of the record on its page.
+     * @param image Data of the record.
+     * @param size Size of the image.
+     * @return Log record.
+     */
+    static LogRecord make_write(const concurrency::timestamp::timestamp_t transaction,
+                                const concurrency::timestamp::timestamp_t commit_timestamp,
+                                const storage::RecordIdentifier record_identifier,
+                                const storage::Page::offset_t slot_start, const std::byte *image,
+                                const std::uint16_t size)
+    {
+        auto record = LogRecord{Type::Write, transaction};
+        record._header.commit_timestamp = commit_timestamp;
+        record.record_identifier(record_identifier);
+        record._header.slot_start = slot_start;
+        record.image(image, size);
+        return record;
+    }
+
+    /**
+     * Creates a record that logs the image of a record restored by an abort.
+     * Without image, the record describes a freed slot.
+     *
+     * @param transaction Begin time of the aborting transaction.
+     * @param record_identifier Slot of the restored record.
+     * @param slot_start Offset of the record on its page.
+     * @param image Data of the record.
+     * @param size Size of the image.
+     * @return Log record.
+     */
+    static LogRecord make_compensation(const concurrency::timestamp::timestamp_t transaction,
+                                       const storage::RecordIdentifier record_identifier,
+                                       const storage::Page::offset_t slot_start, const std::byte *image = nullptr,
+                                       const std::uint16_t size = 0u)
+    {
+        auto record = LogRecord{Type::Compensation, transaction};
+        record.record_identifier(record_identifier);
+        record._header.slot_start = slot_start;
+        record.image(image, size);
+        return record;
+    }
+
+    /**
+     * Creates a record that marks the transaction as committed.
+     *
+     * @param transaction Begin time of the transaction.
+     * @param commit_timestamp Commit time of the transaction.
+     * @return Log record.
+     */
+    static LogRecord make_commit(const concurrency::timestamp::timestamp_t transaction,
+                                 const concurrency::timestamp::timestamp_t commit_timestamp)
+    {
+        auto record = LogRecord{Type::Commit, transaction};
+        record._header.commit_timestamp = commit_timestamp;
+        return record;
+    }
+
+    /**
+     * Creates a record that marks the transaction as aborted;
+     * all its modifications are compensated before.
+     *
+     * @param transaction Begin time of the transaction.
+     * @return Log record.
+     */
+    static LogRecord make_abort(const concurrency::timestamp::timestamp_t transaction)
+    {
+        return LogRecord{Type::Abort, transaction};
+    }
+
+    /**
+     * Creates a checkpoint record.
+     *
+     * @param begin_lsn End of the log when the checkpoint started.
+     * @param dirty_pages Pages dirty at checkpoint time with the LSN of their first unwritten change.
+     * @param active_transactions Transactions active at checkpoint time with the LSN of their first record.
+     * @return Log record.
+     */
+    static LogRecord make_checkpoint(
+        const lsn_t begin_lsn, const std::vector<std::pair<storage::Page::id_t, lsn_t>> &dirty_pages,
+        const std::vector<std::pair<concurrency::timestamp::timestamp_t, lsn_t>> &active_transactions)
+    {
+        auto record = LogRecord{Type::Checkpoint, 0u};
+        auto &image = record._image;
+        append(image, begin_lsn);
+        append(image, std::uint32_t(dirty_pages.size()));
+        for (const auto &[page_id, lsn] : dirty_pages)
+        {
+            append(image, page_id);
+            append(image, lsn);
+        }
+        append(image, std::uint32_t(active_transactions.size()));
+        for (const auto &[transaction, lsn] : active_transactions)
+        {
+            append(image, transaction);
+            append(image, lsn);
+        }
+        record._header.size += image.size();
+        return record;
+    }
+
+    /**
+     * Reads a record from serialized data.
+     *
+     * @param data Serialized data.
+     * @param size Number of available bytes.
+     * @return The record or nothing, when the data holds no complete and valid record.
+     */
+    static std::optional<LogRecord> deserialize(const std::byte *data, const std::size_t size)
+    {
+        if (size < sizeof(Header))
+        {
+            return std::nullopt;
+        }
+
+        auto record = LogRecord{Type::Abort, 0u};
+        std::memcpy(&record._header, data, sizeof(Header));
+        if (record._header.size < sizeof(Header) || record._header.size > size)
+        {
+            return std::nullopt;
+        }
+
+        record._image.assign(data + sizeof(Header), data + record._header.size);
+        if (record.checksum() != record._header.checksum)
+        {
+            return std::nullopt;
+        }
+
+        return std::make_optional(std::move(record));
+    }
+
+    LogRecord(LogRecord &&) = default;
+    LogRecord(const LogRecord &) = default;
+    LogRecord &operator=(LogRecord &&) = default;
+    ~LogRecord() = default;
+
+    [[nodiscard]] Type type() const
+    {
+        return _header.type;
+    }
+
+    [[nodiscard]] concurrency::timestamp::timestamp_t transaction() const
+    {
+        return _header.transaction;
+    }
+
+    [[nodiscard]] concurrency::timestamp::timestamp_t commit_timestamp() const
+    {
+        return _header.commit_timestamp;
+    }
+
+    [[nodiscard]] storage::RecordIdentifier record_identifier() const
+    {
+        return storage::RecordIdentifier{_header.page_id, _header.slot};
+    }
+
+    [[nodiscard]] storage::RecordIdentifier old_record_identifier() const
+    {
+        return storage::RecordIdentifier{_header.old_page_id, _header.old_slot};
+    }
+
+    [[nodiscard]] storage::Page::offset_t slot_start() const
+    {
+        return _header.slot_start;
+    }
+
+    [[nodiscard]] const std::vector<std::byte> &image() const
+    {
+        return _image;
+    }
+
+    /**
+     * @return True, when the record modifies a record of an uncommitted transaction.
+     */
+    [[nodiscard]] bool is_modification() const
+    {
+        return _header.type == Type::Insert || _header.type == Type::Update || _header.type == Type::Delete;
+    }
+
+    /**
+     * @return End of the log when the checkpoint started (checkpoint records only).
+     */
+    [[nodiscard]] lsn_t checkpoint_begin_lsn() const
+    {
+        return read<lsn_t>(0u);
+    }
+
+    /**
+     * @return Dirty pages recorded by the checkpoint (checkpoint records only).
+     */
+    [[nodiscard]] std::vector<std::pair<storage::Page::id_t, lsn_t>> dirty_pages() const
+    {
+        auto offset = sizeof(lsn_t);
+        const auto count = read<std::uint32_t>(offset);
+        offset += sizeof(std::uint32_t);
+
+        std::vector<std::pair<storage::Page::id_t, lsn_t>> dirty_pages;
+        dirty_pages.reserve(count);
+        for (auto i = 0u; i < count; ++i)
+        {
+            const auto page_id = read<storage::Page::id_t>(offset);
+            const auto lsn = read<lsn_t>(offset + sizeof(storage::Page::id_t));
+            dirty_pages.emplace_back(page_id, lsn);
+            offset += sizeof(storage::Page::id_t) + sizeof(lsn_t);
+        }
+        return dirty_pages;
+    }
+
+    /**
+     * @return Active transactions recorded by the checkpoint (checkpoint records only).
+     */
+    [[nodiscard]] std::vector<std::pair<concurrency::timestamp::timestamp_t, lsn_t>> active_transactions() const
+    {
+        auto offset = sizeof(lsn_t);
+        offset += sizeof(std::uint32_t) + read<std::uint32_t>(offset) * (sizeof(storage::Page::id_t) + sizeof(lsn_t));
+        const auto count = read<std::uint32_t>(offset);
+        offset += sizeof(std::uint32_t);
+
+        std::vector<std::pair<concurrency::timestamp::timestamp_t, lsn_t>> active_transactions;
+        active_transactions.reserve(count);
+        for (auto i = 0u; i < count; ++i)
+        {
+            const auto transaction = read<concurrency::timestamp::timestamp_t>(offset);
+            const auto lsn = read<lsn_t>(offset + sizeof(concurrency::timestamp::timestamp_t));
+            active_transactions.emplace_back(transaction, lsn);
+            offset += sizeof(concurrency::timestamp::timestamp_t) + sizeof(lsn_t);
+        }
+        return active_transactions;
+    }
+
+    /**
+     * @return Number of bytes the record occupies in the log.
+     */
+    [[nodiscard]] std::uint32_t size() const
+    {
+        return _header.size;
+    }
+
+    /**
+     * Appends the serialized record to the given buffer.
+     *
+     * @param buffer Buffer to serialize the record into.
+     */
+    void serialize(std::vector<std::byte> &buffer) const
+    {
+        auto header = _header;
+        header.checksum = this->checksum();
+
+        const auto offset = buffer.size();
+        buffer.resize(offset + _header.size);
+        std::memcpy(buffer.data() + offset, &header, sizeof(Header));
+        std::memcpy(buffer.data() + offset + sizeof(Header), _image.data(), _image.size());
+    }
+
+  private:
+    LogRecord(const Type type, const concurrency::timestamp::timestamp_t transaction)
+    {
+        // Clear padding to keep the log (and its checksums) deterministic.
+        std::memset(&_header, 0, sizeof(Header));
+        _header.size = sizeof(Header);
+        _header.type = type;
+        _header.transaction = transaction;
+        _header.page_id = storage::Page::INVALID_PAGE_ID;
+        _header.old_page_id = storage::Page::INVALID_PAGE_ID;
+    }
+
+    Header _header;
+    std::vector<std::byte> _image;
+
+    void record_identifier(const storage::RecordIdentifier record_identifier)
+    {
+        _header.page_id = record_identifier.page_id();
+        _header.slot = record_identifier.slot();
+    }
+
+    void image(const std::byte *image, const std::uint16_t size)
+    {
+        if (size > 0u)
+        {
+            _image.assign(image, image + size);
+            _header.size += size;
+        }
+    }
+
+    /**
+     * @return FNV-1a hash over the header (without checksum) and the image.
+     */
+    [[nodiscard]] std::uint32_t checksum() const
+    {
+        auto header = _header;
+        header.checksum = 0u;
+
+        auto hash = std::uint32_t{2166136261u};
+        const auto *header_data = reinterpret_cast<const std::byte *>(&header);
+        for (auto i = 0u; i < sizeof(Header); ++i)
+        {
+            hash = (hash ^ std::uint32_t(header_data[i])) * 16777619u;
+        }
+        for (const auto byte : _image)
+        {
+            hash = (hash ^ std::uint32_t(byte)) * 16777619u;
+        }
+        return hash;
+    }
+
+    template <typename T> static void append(std::vector<std::byte> &image, const T value)
+    {
+        const auto offset = image.size();
+        image.resize(offset + sizeof(T));
+        std::memcpy(image.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T> [[nodiscard]] T read(const std::size_t offset) const
+    {
+        T value;
+        std::memcpy(&value, _image.data() + offset, sizeof(T));
+        return value;
+    }
+};
+} // namespace beedb::recovery
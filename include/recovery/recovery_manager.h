@@ -0,0 +1,98 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include "log_manager.h"
+#include "log_record.h"
+#include <buffer/manager.h>
+#include <concurrency/timestamp.h>
+#include <optional>
+#include <storage/manager.h>
+
+namespace beedb::recovery
+{
+/**
+ * The RecoveryManager takes checkpoints and restores a consistent state
+ * after a crash, following ARIES:
+ *
+ *  - Analysis: Starting at the latest checkpoint, the log is scanned to find
+ *    the dirty pages and the transactions that did not end (losers).
+ *  - Redo: Committed writes and compensations are repeated on all pages that
+ *    may not have reached the disk.
+ *  - Undo: Modifications of losers are reverted, newest first.
+ *
+ * Checkpoints are fuzzy: They do not stop transactions, but record the
+ * dirty pages and the active transactions. To bound the log that has to be
+ * scanned, pages dirty for long are written back while taking the checkpoint.
+ *
+ * Records are identified by the slot they live in and logged with full images,
+ * so redoing a record is idempotent. Undo reverts only records still carrying
+ * the timestamps of the loser, which makes it idempotent, too.
+ */
+class RecoveryManager
+{
+  public:
+    RecoveryManager(storage::Manager &storage_manager, buffer::Manager &buffer_manager, LogManager &log_manager)
+        : _storage_manager(storage_manager), _buffer_manager(buffer_manager), _log_manager(log_manager)
+    {
+    }
+
+    ~RecoveryManager() = default;
+
+    /**
+     * Takes a fuzzy checkpoint.
+     *
+     * @param recovery_lsn Dirty pages changed before this LSN are written back before.
+     * @return LSN of the checkpoint record.
+     */
+    lsn_t checkpoint(lsn_t recovery_lsn);
+
+    /**
+     * Recovers the pages after a crash. The recovered pages stay dirty
+     * in the buffer; a checkpoint writes them back.
+     *
+     * @param checkpoint_lsn LSN of the latest checkpoint; 0 when there is none.
+     * @return The highest timestamp found in the log.
+     */
+    concurrency::timestamp::timestamp_t recover(lsn_t checkpoint_lsn);
+
+  private:
+    storage::Manager &_storage_manager;
+    buffer::Manager &_buffer_manager;
+    LogManager &_log_manager;
+
+    /**
+     * Repeats a write or compensation on its page.
+     *
+     * @param record Log record to redo.
+     */
+    void redo(const LogRecord &record);
+
+    /**
+     * Reverts a modification of a transaction that did not commit.
+     *
+     * @param record Log record of the modification.
+     * @param commit_timestamp Commit time, when the transaction crashed while committing.
+     */
+    void undo(const LogRecord &record, std::optional<concurrency::timestamp::timestamp_t> commit_timestamp);
+};
+} // namespace beedb::recovery
@@ -0,0 +1,122 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <config.h>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace beedb::statistic
+{
+/**
+ * Bounded store of correction factors for selectivity estimates, keyed
+ * by the signature of the predicate. After executing a plan, the observed
+ * selectivity of each predicate is compared to the estimated one; later
+ * estimates of the same predicate are multiplied by the learned factor.
+ * When the store is full, the least recently used factor is dropped.
+ */
+class CardinalityFeedback
+{
+  public:
+    explicit CardinalityFeedback(const std::size_t capacity = Config::statistic_cardinality_feedback_capacity)
+        : _capacity(capacity)
+    {
+    }
+
+    ~CardinalityFeedback() = default;
+
+    /**
+     * @param signature Signature of the predicate.
+     * @return Factor to correct the estimated selectivity of the predicate; 1.0 if nothing was learned.
+     */
+    [[nodiscard]] double correction(const std::string &signature)
+    {
+        std::unique_lock _{_latch};
+        if (auto iterator = _index.find(signature); iterator != _index.end())
+        {
+            _factors.splice(_factors.begin(), _factors, iterator->second);
+            return iterator->second->second;
+        }
+
+        return 1.0;
+    }
+
+    /**
+     * Learns from an executed predicate.
+     *
+     * @param signature Signature of the predicate.
+     * @param estimated_selectivity Selectivity estimated from the statistics, without correction.
+     * @param actual_selectivity Selectivity observed while executing.
+     */
+    void record(const std::string &signature, const double estimated_selectivity, const double actual_selectivity)
+    {
+        if (estimated_selectivity <= 0.0)
+        {
+            return;
+        }
+
+        auto factor = std::clamp(actual_selectivity / estimated_selectivity, min_factor, max_factor);
+
+        std::unique_lock _{_latch};
+        if (auto iterator = _index.find(signature); iterator != _index.end())
+        {
+            // Damp single outliers by averaging with the factor learned before.
+            factor = std::sqrt(iterator->second->second * factor);
+            iterator->second->second = factor;
+            _factors.splice(_factors.begin(), _factors, iterator->second);
+            return;
+        }
+
+        if (_factors.size() >= _capacity && _factors.empty() == false)
+        {
+            _index.erase(_factors.back().first);
+            _factors.pop_back();
+        }
+
+        _factors.emplace_front(signature, factor);
+        _index.insert(std::make_pair(signature, _factors.begin()));
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        std::unique_lock _{_latch};
+        return _factors.size();
+    }
+
+  private:
+    static constexpr auto min_factor = 1e-4;
+    static constexpr auto max_factor = 1e4;
+
+    const std::size_t _capacity;
+
+    // Most recently used factors first.
+    std::list<std::pair<std::string, double>> _factors;
+    std::unordered_map<std::string, std::list<std::pair<std::string, double>>::iterator> _index;
+    mutable std::mutex _latch;
+};
+} // namespace beedb::statistic
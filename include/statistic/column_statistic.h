@@ -0,0 +1,189 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include "histogram.h"
+#include "hyper_log_log.h"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <table/type.h>
+#include <table/value.h>
+#include <utility>
+#include <vector>
+
+namespace beedb::statistic
+{
+/**
+ * Statistics for a single column: fraction of null values, number
+ * of distinct values, minimum and maximum, most common values with
+ * their frequency and an equi-depth histogram.
+ *
+ * All values are mapped to a numeric domain (see ColumnStatistic::to_numeric),
+ * which preserves the order of the values for all types.
+ */
+class ColumnStatistic
+{
+  public:
+    // Default selectivities, used when no statistics are available.
+    static constexpr double default_equals_selectivity = 0.005;
+    static constexpr double default_range_selectivity = 1.0 / 3.0;
+
+    ColumnStatistic() = default;
+    ColumnStatistic(const double null_fraction, const std::uint64_t count_distinct, const double min, const double max,
+                    std::vector<std::pair<double, double>> &&most_common_values, EquiDepthHistogram &&histogram)
+        : _null_fraction(null_fraction), _count_distinct(count_distinct), _min(min), _max(max),
+          _most_common_values(std::move(most_common_values)), _histogram(std::move(histogram))
+    {
+    }
+
+    ~ColumnStatistic() = default;
+
+    /**
+     * Maps a value to a numeric domain that preserves the order of values.
+     * Dates are mapped to yyyymmdd, strings to their first eight characters.
+     *
+     * @param value Value to map.
+     * @return Numeric representation of the value.
+     */
+    [[nodiscard]] static double to_numeric(const table::Value &value);
+
+    /**
+     * Parses most common values serialized by ColumnStatistic::most_common_values_to_string().
+     *
+     * @param serialized Serialized most common values.
+     * @return List of (value, frequency) pairs.
+     */
+    [[nodiscard]] static std::vector<std::pair<double, double>> most_common_values_from_string(
+        const std::string &serialized);
+
+    /**
+     * @return Most common values serialized as "value:frequency" pairs, separated by ';'.
+     */
+    [[nodiscard]] std::string most_common_values_to_string() const;
+
+    [[nodiscard]] double null_fraction() const
+    {
+        return _null_fraction;
+    }
+
+    [[nodiscard]] std::uint64_t count_distinct() const
+    {
+        return _count_distinct;
+    }
+
+    [[nodiscard]] double min() const
+    {
+        return _min;
+    }
+
+    [[nodiscard]] double max() const
+    {
+        return _max;
+    }
+
+    [[nodiscard]] const std::vector<std::pair<double, double>> &most_common_values() const
+    {
+        return _most_common_values;
+    }
+
+    [[nodiscard]] const EquiDepthHistogram &histogram() const
+    {
+        return _histogram;
+    }
+
+    /**
+     * Estimates the fraction of rows where the column equals the given value.
+     *
+     * @param value Numeric mapped value.
+     * @return Selectivity in [0, 1].
+     */
+    [[nodiscard]] double selectivity_equals(double value) const;
+
+    /**
+     * Estimates the fraction of rows where the column is lesser (or equal) than the given value.
+     *
+     * @param value Numeric mapped value.
+     * @param is_inclusive True, if the value itself is included (<=).
+     * @return Selectivity in [0, 1].
+     */
+    [[nodiscard]] double selectivity_lesser(double value, bool is_inclusive) const;
+
+    /**
+     * Estimates the fraction of rows where the column is greater (or equal) than the given value.
+     *
+     * @param value Numeric mapped value.
+     * @param is_inclusive True, if the value itself is included (>=).
+     * @return Selectivity in [0, 1].
+     */
+    [[nodiscard]] double selectivity_greater(double value, bool is_inclusive) const
+    {
+        return std::max(0.0, (1.0 - _null_fraction) - selectivity_lesser(value, is_inclusive == false));
+    }
+
+  private:
+    double _null_fraction = 0.0;
+    std::uint64_t _count_distinct = 0u;
+    double _min = 0.0;
+    double _max = 0.0;
+    std::vector<std::pair<double, double>> _most_common_values;
+    EquiDepthHistogram _histogram;
+};
+
+/**
+ * Collects the values of a column and builds the ColumnStatistic.
+ */
+class ColumnStatisticBuilder
+{
+  public:
+    explicit ColumnStatisticBuilder(const table::Type type) : _type(type)
+    {
+    }
+
+    ~ColumnStatisticBuilder() = default;
+
+    /**
+     * Adds a value of the column.
+     *
+     * @param value Value.
+     */
+    void add(const table::Value &value);
+
+    /**
+     * Builds the statistic from all added values.
+     *
+     * @param count_buckets Maximal number of histogram buckets.
+     * @param count_most_common_values Maximal number of most common values.
+     * @param sampled_fraction Fraction of the table the values were sampled from.
+     * @return Statistic of the column.
+     */
+    [[nodiscard]] ColumnStatistic build(std::size_t count_buckets, std::size_t count_most_common_values,
+                                        double sampled_fraction = 1.0);
+
+  private:
+    const table::Type _type;
+    std::uint64_t _count_values = 0u;
+    std::uint64_t _count_nulls = 0u;
+    HyperLogLog _distinct_values;
+    std::vector<double> _values;
+};
+} // namespace beedb::statistic
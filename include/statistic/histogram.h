@@ -0,0 +1,101 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace beedb::statistic
+{
+/**
+ * Equi-depth histogram over the (numeric mapped) values of a column.
+ * Every bucket holds the same number of values; the histogram only
+ * stores the bucket bounds. Bucket i covers [bounds[i], bounds[i+1]].
+ */
+class EquiDepthHistogram
+{
+  public:
+    EquiDepthHistogram() = default;
+    explicit EquiDepthHistogram(std::vector<double> &&bounds) : _bounds(std::move(bounds))
+    {
+    }
+
+    ~EquiDepthHistogram() = default;
+
+    /**
+     * Builds a histogram from sorted values.
+     *
+     * @param sorted_values Values, sorted ascending.
+     * @param count_buckets Maximal number of buckets.
+     * @return Histogram.
+     */
+    [[nodiscard]] static EquiDepthHistogram build(const std::vector<double> &sorted_values, std::size_t count_buckets);
+
+    /**
+     * Parses a histogram serialized by EquiDepthHistogram::to_string().
+     *
+     * @param serialized Serialized histogram.
+     * @return Histogram.
+     */
+    [[nodiscard]] static EquiDepthHistogram from_string(const std::string &serialized);
+
+    /**
+     * @return Serialized bounds, separated by ';'.
+     */
+    [[nodiscard]] std::string to_string() const;
+
+    /**
+     * @return True, when the histogram contains no bucket.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _bounds.size() < 2u;
+    }
+
+    /**
+     * @return Number of buckets.
+     */
+    [[nodiscard]] std::size_t count_buckets() const
+    {
+        return empty() ? 0u : _bounds.size() - 1u;
+    }
+
+    [[nodiscard]] const std::vector<double> &bounds() const
+    {
+        return _bounds;
+    }
+
+    /**
+     * Estimates the fraction of values lesser than the given value.
+     * Values within a bucket are assumed to be uniformly distributed.
+     *
+     * @param value Value.
+     * @return Fraction in [0, 1].
+     */
+    [[nodiscard]] double fraction_lesser(double value) const;
+
+  private:
+    std::vector<double> _bounds;
+};
+} // namespace beedb::statistic
@@ -0,0 +1,126 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace beedb::statistic
+{
+/**
+ * HyperLogLog sketch for estimating the number of distinct
+ * values of a column using constant memory.
+ * Values are added as (64bit) hashes; the first bits of the hash
+ * select the register, the remaining bits determine the number
+ * of leading zeros stored in the register.
+ */
+class HyperLogLog
+{
+  public:
+    static constexpr std::uint8_t precision = 10u;
+    static constexpr std::uint32_t count_registers = 1u << precision;
+
+    HyperLogLog()
+    {
+        _registers.fill(0u);
+    }
+
+    ~HyperLogLog() = default;
+
+    /**
+     * Adds the hash of a value to the sketch.
+     *
+     * @param hash Hash of the value.
+     */
+    void add(std::uint64_t hash)
+    {
+        // std::hash is the identity for integers; mix the bits
+        // to spread the values over all registers.
+        hash = HyperLogLog::mix(hash);
+
+        const auto register_index = hash >> (64u - precision);
+        const auto remaining = (hash << precision) | (1u << (precision - 1u));
+        const auto rank = static_cast<std::uint8_t>(HyperLogLog::leading_zeros(remaining) + 1u);
+        _registers[register_index] = std::max(_registers[register_index], rank);
+    }
+
+    /**
+     * Merges another sketch into this one.
+     *
+     * @param other Other sketch.
+     */
+    void merge(const HyperLogLog &other)
+    {
+        for (auto i = 0u; i < count_registers; ++i)
+        {
+            _registers[i] = std::max(_registers[i], other._registers[i]);
+        }
+    }
+
+    /**
+     * @return Estimated number of distinct values added to the sketch.
+     */
+    [[nodiscard]] std::uint64_t estimate() const
+    {
+        constexpr auto m = double(count_registers);
+        const auto alpha = 0.7213 / (1.0 + 1.079 / m);
+
+        auto sum = 0.0;
+        auto count_zero_registers = 0u;
+        for (const auto value : _registers)
+        {
+            sum += std::ldexp(1.0, -value);
+            count_zero_registers += static_cast<std::uint32_t>(value == 0u);
+        }
+
+        auto estimate = alpha * m * m / sum;
+
+        // Small range correction: use linear counting.
+        if (estimate <= 2.5 * m && count_zero_registers > 0u)
+        {
+            estimate = m * std::log(m / double(count_zero_registers));
+        }
+
+        return static_cast<std::uint64_t>(std::llround(estimate));
+    }
+
+  private:
+    std::array<std::uint8_t, count_registers> _registers;
+
+    [[nodiscard]] static std::uint64_t mix(std::uint64_t hash)
+    {
+        hash ^= hash >> 33u;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33u;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33u;
+        return hash;
+    }
+
+    [[nodiscard]] static std::uint8_t leading_zeros(const std::uint64_t value)
+    {
+        return static_cast<std::uint8_t>(__builtin_clzll(value));
+    }
+};
+} // namespace beedb::statistic
@@ -0,0 +1,101 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+#include "column_statistic.h"
+#include "system_statistics.h"
+#include <cstdint>
+#include <expression/operation.h>
+#include <expression/term.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <table/table.h>
+
+namespace beedb::statistic
+{
+/**
+ * Estimates the selectivity of predicates on a single table,
+ * based on the column statistics. Conjunctions and disjunctions
+ * are estimated assuming independent predicates.
+ */
+class SelectivityEstimator
+{
+  public:
+    SelectivityEstimator(SystemStatistics &statistics, table::Table &table)
+        : _statistics(statistics), _table(table), _table_alias(table.name())
+    {
+    }
+
+    /**
+     * @param statistics Statistics of the database.
+     * @param table Table the predicates are evaluated on.
+     * @param table_alias Alias of the table, used by attributes of the predicates.
+     */
+    SelectivityEstimator(SystemStatistics &statistics, table::Table &table, std::string table_alias)
+        : _statistics(statistics), _table(table), _table_alias(std::move(table_alias))
+    {
+    }
+
+    ~SelectivityEstimator() = default;
+
+    /**
+     * Estimates the fraction of rows of the table qualifying the predicate.
+     *
+     * @param predicate Predicate.
+     * @return Selectivity in [0, 1].
+     */
+    [[nodiscard]] double estimate(const std::unique_ptr<expression::Operation> &predicate) const;
+
+    /**
+     * Estimates the number of rows of the table qualifying the predicate.
+     *
+     * @param predicate Predicate.
+     * @return Estimated cardinality.
+     */
+    [[nodiscard]] std::uint64_t estimate_cardinality(const std::unique_ptr<expression::Operation> &predicate) const;
+
+  private:
+    SystemStatistics &_statistics;
+    table::Table &_table;
+    const std::string _table_alias;
+
+    [[nodiscard]] double estimate_comparison(const expression::BinaryOperation *comparison) const;
+
+    /**
+     * Looks up the column of the table referenced by the attribute.
+     *
+     * @param term Term that may be an attribute.
+     * @return Index of the column in the table schema.
+     */
+    [[nodiscard]] std::optional<std::size_t> column_index(const expression::Term &term) const;
+
+    /**
+     * Maps the value of a term to the numeric domain of the column statistics.
+     *
+     * @param term Term holding a value.
+     * @param type Type of the compared column.
+     * @return Numeric value or nullopt, if the term holds no comparable value.
+     */
+    [[nodiscard]] static std::optional<double> to_numeric(const expression::Term &term, table::Type type);
+};
+} // namespace beedb::statistic
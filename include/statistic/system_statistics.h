@@ -21,7 +21,12 @@
  */
 
 #pragma once
+#include "cardinality_feedback.h"
+#include "column_statistic.h"
 #include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <table/table.h>
 #include <unordered_map>
 
@@ -44,11 +49,13 @@ class TableStatistic
 
     void cardinality(const std::int32_t table_id, const std::uint64_t cardinality)
     {
+        std::unique_lock _{_latch};
         _cardinality[table_id] = cardinality;
     }
 
     [[nodiscard]] std::uint64_t cardinality(table::Table &table) const
     {
+        std::unique_lock _{_latch};
         if (_cardinality.find(table.id()) == _cardinality.end())
         {
             return 0u;
@@ -59,6 +66,7 @@ class TableStatistic
 
     void add_cardinality(table::Table &table, const std::uint64_t cardinality = 1u)
     {
+        std::unique_lock _{_latch};
         if (_cardinality.find(table.id()) != _cardinality.end())
         {
             _cardinality[table.id()] += cardinality;
@@ -71,14 +79,73 @@ class TableStatistic
 
     [[maybe_unused]] void sub_cardinality(table::Table &table, const std::uint64_t cardinality = 1u)
     {
+        std::unique_lock _{_latch};
         if (_cardinality.find(table.id()) != _cardinality.end())
         {
             _cardinality[table.id()] -= cardinality;
         }
     }
 
+    /**
+     * Counts rows modified (inserted, updated, deleted) since the table was analyzed.
+     *
+     * @param table Modified table.
+     * @param count_rows Number of modified rows.
+     * @return Number of modified rows since the last analyze.
+     */
+    std::uint64_t add_modifications(table::Table &table, const std::uint64_t count_rows)
+    {
+        std::unique_lock _{_latch};
+        return _modifications[table.id()] += count_rows;
+    }
+
+    void reset_modifications(table::Table &table)
+    {
+        std::unique_lock _{_latch};
+        _modifications.erase(table.id());
+    }
+
   private:
     std::unordered_map<table::Table::id_t, std::uint64_t> _cardinality;
+    std::unordered_map<table::Table::id_t, std::uint64_t> _modifications;
+    mutable std::mutex _latch;
+};
+
+/**
+ * Container for managing statistics regarding columns.
+ * Column statistics are replaced as a whole (e.g. after analyzing
+ * a table) while queries read them; accesses are latched.
+ */
+class ColumnStatistics
+{
+  public:
+    ColumnStatistics() = default;
+    ~ColumnStatistics() = default;
+
+    void statistic(const std::int32_t column_id, ColumnStatistic &&statistic)
+    {
+        std::unique_lock _{_latch};
+        _statistics.insert_or_assign(column_id, std::move(statistic));
+    }
+
+    /**
+     * @param column_id Id of the column.
+     * @return Copy of the statistic for the column, if the column was analyzed.
+     */
+    [[nodiscard]] std::optional<ColumnStatistic> statistic(const std::int32_t column_id) const
+    {
+        std::shared_lock _{_latch};
+        if (auto iterator = _statistics.find(column_id); iterator != _statistics.end())
+        {
+            return std::make_optional(iterator->second);
+        }
+
+        return std::nullopt;
+    }
+
+  private:
+    std::unordered_map<std::int32_t, ColumnStatistic> _statistics;
+    mutable std::shared_mutex _latch;
 };
 
 class SystemStatistics
@@ -92,8 +159,20 @@ class SystemStatistics
         return _table_statistics;
     }
 
+    [[nodiscard]] ColumnStatistics &column_statistics()
+    {
+        return _column_statistics;
+    }
+
+    [[nodiscard]] CardinalityFeedback &cardinality_feedback()
+    {
+        return _cardinality_feedback;
+    }
+
   private:
     TableStatistic _table_statistics;
+    ColumnStatistics _column_statistics;
+    CardinalityFeedback _cardinality_feedback;
 };
 
 } // namespace beedb::statistic
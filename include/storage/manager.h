@@ -55,6 +55,11 @@ class Manager
      */
     void write(Page::id_t page_id, const std::byte *data);
 
+    /**
+     * Forces all written pages to the disk.
+     */
+    void sync();
+
     /**
      * Allocates a new page in the disk file and extends the
      * file by the new allocated page.
@@ -79,6 +84,7 @@ class Manager
     }
 
   private:
+    const std::string _file_name;
     std::atomic_size_t _count_pages = 0u;
     std::fstream _storage_file;
 };
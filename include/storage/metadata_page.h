@@ -30,6 +30,12 @@ namespace beedb::storage
 class MetadataPage final : public Page
 {
   public:
+    /**
+     * Version of the file layout (e.g., the system pages). Files written
+     * with another version are rejected on boot.
+     */
+    static constexpr std::uint32_t current_format_version = 1u;
+
     MetadataPage() = default;
 
     ~MetadataPage() override = default;
@@ -43,5 +49,37 @@ class MetadataPage final : public Page
     {
         *reinterpret_cast<concurrency::timestamp::timestamp_t *>(Page::data() + sizeof(Page::id_t)) = timestamp;
     }
+
+    /**
+     * @return LSN of the latest complete checkpoint; 0 when no checkpoint was taken.
+     */
+    [[nodiscard]] std::uint64_t checkpoint_lsn() const
+    {
+        return *reinterpret_cast<const std::uint64_t *>(Page::data() + sizeof(Page::id_t) +
+                                                        sizeof(concurrency::timestamp::timestamp_t));
+    }
+
+    void checkpoint_lsn(const std::uint64_t lsn)
+    {
+        *reinterpret_cast<std::uint64_t *>(Page::data() + sizeof(Page::id_t) +
+                                           sizeof(concurrency::timestamp::timestamp_t)) = lsn;
+    }
+
+    /**
+     * @return Version of the file layout; 0 for files written before the version was stored.
+     */
+    [[nodiscard]] std::uint32_t format_version() const
+    {
+        return *reinterpret_cast<const std::uint32_t *>(Page::data() + sizeof(Page::id_t) +
+                                                        sizeof(concurrency::timestamp::timestamp_t) +
+                                                        sizeof(std::uint64_t));
+    }
+
+    void format_version(const std::uint32_t format_version)
+    {
+        *reinterpret_cast<std::uint32_t *>(Page::data() + sizeof(Page::id_t) +
+                                           sizeof(concurrency::timestamp::timestamp_t) + sizeof(std::uint64_t)) =
+            format_version;
+    }
 };
 } // namespace beedb::storage
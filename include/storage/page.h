@@ -21,6 +21,7 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <config.h>
@@ -99,6 +100,44 @@ class Page
         _is_dirty = is_dirty;
     }
 
+    /**
+     * @return LSN of the latest log record describing a change on this page.
+     */
+    [[nodiscard]] std::uint64_t lsn() const
+    {
+        return _lsn;
+    }
+
+    /**
+     * @return LSN of the first log record describing a change not yet written to disk.
+     */
+    [[nodiscard]] std::uint64_t recovery_lsn() const
+    {
+        return _recovery_lsn;
+    }
+
+    /**
+     * Notes a log record describing a change on this page.
+     * @param lsn LSN of the log record.
+     */
+    void lsn(std::uint64_t lsn)
+    {
+        _lsn = std::max(_lsn, lsn);
+        if (_recovery_lsn == 0u)
+        {
+            _recovery_lsn = lsn;
+        }
+    }
+
+    /**
+     * Forgets the logged changes, when the page was written to (or read from) disk.
+     */
+    void reset_lsn()
+    {
+        _lsn = 0u;
+        _recovery_lsn = 0u;
+    }
+
     /**
      * @return Id of the page which is logical connected to this page.
      */
@@ -160,6 +199,8 @@ class Page
     // std::shared_mutex _rw_latch;
     std::uint64_t _pin_count = 0u;
     bool _is_dirty = false;
+    std::uint64_t _lsn = 0u;
+    std::uint64_t _recovery_lsn = 0u;
 
     // Page data
     std::array<std::byte, Config::page_size> _data{std::byte{'\0'}};
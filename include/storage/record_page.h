@@ -23,6 +23,7 @@
 #pragma once
 
 #include "page.h"
+#include <algorithm>
 #include <concurrency/metadata.h>
 
 namespace beedb::storage
@@ -138,6 +139,37 @@ class RecordPage final : public Page
         return slot_id;
     }
 
+    /**
+     * Places a record of the given size at the given slot and offset,
+     * used to redo records on pages that were not written back before a crash.
+     * Slots missing in front of the slot are created as free slots.
+     *
+     * @param slot_id Slot of the record.
+     * @param start Offset of the record on the page.
+     * @param size Size of the record, including the metadata.
+     */
+    void restore_slot(const std::uint16_t slot_id, const Page::offset_t start, const std::uint16_t size)
+    {
+        const auto slots = this->slots();
+        for (auto id = slots; id < slot_id; ++id)
+        {
+            auto *slot = new (Page::data() + sizeof(Page::id_t) + sizeof(std::uint16_t) + sizeof(std::uint16_t) +
+                              (id * sizeof(Slot))) Slot(Config::page_size, 0u);
+            slot->is_free(true);
+        }
+
+        new (Page::data() + sizeof(Page::id_t) + sizeof(std::uint16_t) + sizeof(std::uint16_t) +
+             (slot_id * sizeof(Slot))) Slot(start, size);
+        if (slot_id >= slots)
+        {
+            this->slots(slot_id + 1u);
+        }
+
+        auto *free_space_pointer =
+            reinterpret_cast<std::uint16_t *>(Page::data() + sizeof(Page::id_t) + sizeof(std::uint16_t));
+        *free_space_pointer = std::min(*free_space_pointer, start);
+    }
+
     void write(const std::uint16_t slot_id, const concurrency::Metadata *concurrency_metadata, const std::byte *payload,
                const std::uint16_t size)
     {
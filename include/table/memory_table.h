@@ -130,6 +130,14 @@ class MemoryTable
         return _tuples.size();
     }
 
+    /**
+     * @return Bytes of memory allocated for the stored tuples.
+     */
+    [[nodiscard]] std::size_t memory_usage() const
+    {
+        return _capacity * _row_size + _tuples.capacity() * sizeof(Tuple);
+    }
+
     /**
      * Grants access to a specific tuple.
      * @param index Index of the tuple.
@@ -28,6 +28,7 @@
 #include <buffer/manager.h>
 #include <concurrency/transaction.h>
 #include <cstdint>
+#include <recovery/log_manager.h>
 #include <storage/page.h>
 #include <unordered_set>
 #include <util/optional.h>
@@ -38,11 +39,13 @@ namespace beedb::table
 {
 /**
  * The TableDiskManager specifies the interface between tables and the disk.
+ * Uncommitted modifications are logged, so they can be undone when
+ * the transaction did not commit before a crash.
  */
 class TableDiskManager
 {
   public:
-    explicit TableDiskManager(buffer::Manager &buffer_manager);
+    TableDiskManager(buffer::Manager &buffer_manager, recovery::LogManager &log_manager);
     ~TableDiskManager() = default;
 
     /**
@@ -101,8 +104,19 @@ class TableDiskManager
      */
     void remove_row(Table &table, const storage::RecordIdentifier record_identifier);
 
+    /**
+     * Logs an uncommitted update or delete, before it is added to the write set.
+     * Inserts are logged when the row is added. The page holding the modified
+     * record has to be pinned until the modification is logged.
+     *
+     * @param transaction Modifying transaction.
+     * @param write_set_item Modification.
+     */
+    void log_modification(concurrency::Transaction *transaction, const concurrency::WriteSetItem &write_set_item);
+
   private:
     buffer::Manager &_buffer_manager;
+    recovery::LogManager &_log_manager;
 
     /**
      * Scans for a page with enough free space for a new tuple.
@@ -0,0 +1,71 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace beedb::util
+{
+/**
+ * Fast LZ77 compressor for blocks of data (e.g., chunks of results sent
+ * to clients), using the sequence layout of LZ4: Every sequence starts
+ * with a token (4 bits literal length, 4 bits match length), followed by
+ * the literals and the 2 byte offset of the match. Lengths exceeding the
+ * token are continued by bytes of 255 and the remainder. The last sequence
+ * consists of literals only.
+ */
+class BlockCompressor
+{
+  public:
+    /**
+     * Compresses a block and appends the compressed data.
+     *
+     * @param data Block to compress.
+     * @param size Size of the block.
+     * @param compressed Buffer the compressed data is appended to.
+     * @return True, when the compressed data is smaller than the block.
+     */
+    static bool compress(const std::byte *data, std::size_t size, std::vector<std::byte> &compressed);
+
+    /**
+     * Decompresses a block and appends the data.
+     *
+     * @param compressed Compressed block.
+     * @param compressed_size Size of the compressed block.
+     * @param size Size of the decompressed block.
+     * @param data Buffer the decompressed data is appended to.
+     */
+    static void decompress(const std::byte *compressed, std::size_t compressed_size, std::size_t size,
+                           std::vector<std::byte> &data);
+
+  private:
+    static constexpr auto min_match_length = 4u;
+    static constexpr auto max_offset = 65535u;
+    static constexpr auto hash_bits = 12u;
+
+    static void write_length(std::size_t length, std::vector<std::byte> &compressed);
+    static std::size_t read_length(const std::byte *compressed, std::size_t &index);
+};
+} // namespace beedb::util
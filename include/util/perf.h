@@ -23,11 +23,13 @@
 #pragma once
 #include <algorithm>
 #include <asm/unistd.h>
+#include <cstdint>
 #include <cstring>
 #include <linux/perf_event.h>
 #include <string>
 #include <sys/ioctl.h>
 #include <unistd.h>
+#include <utility>
 #include <vector>
 
 /*
@@ -51,6 +53,17 @@ namespace beedb::util
 class PerfCounter
 {
   public:
+    /**
+     * Value of the counter together with the times the counter was
+     * enabled and running (to correct multiplexing).
+     */
+    struct read_format
+    {
+        std::uint64_t value = 0;
+        std::uint64_t time_enabled = 0;
+        std::uint64_t time_running = 0;
+    };
+
     PerfCounter(std::string &&name, const std::uint64_t type, const std::uint64_t event_id) : _name(std::move(name))
     {
         std::memset(&_perf_event_attribute, 0, sizeof(perf_event_attr));
@@ -64,8 +77,33 @@ class PerfCounter
         _perf_event_attribute.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
     }
 
-    ~PerfCounter() = default;
+    /**
+     * Copies the definition of the counter, not the opened counter.
+     */
+    PerfCounter(const PerfCounter &other) : _name(other._name), _perf_event_attribute(other._perf_event_attribute)
+    {
+    }
+
+    PerfCounter(PerfCounter &&other) noexcept
+        : _name(other._name), _file_descriptor(other._file_descriptor),
+          _perf_event_attribute(other._perf_event_attribute), _prev(other._prev), _data(other._data)
+    {
+        other._file_descriptor = -1;
+    }
 
+    ~PerfCounter()
+    {
+        if (_file_descriptor >= 0)
+        {
+            ::close(_file_descriptor);
+        }
+    }
+
+    /**
+     * Opens the counter for the calling thread.
+     *
+     * @return True, when the counter is supported and permitted.
+     */
     bool open()
     {
         _file_descriptor = syscall(__NR_perf_event_open, &_perf_event_attribute, 0, -1, -1, 0);
@@ -88,9 +126,35 @@ class PerfCounter
 
     [[nodiscard]] double read() const
     {
-        const auto multiplexing_correction = static_cast<double>(_data.time_enabled - _prev.time_enabled) /
-                                             static_cast<double>(_data.time_running - _prev.time_running);
-        return static_cast<double>(_data.value - _prev.value) * multiplexing_correction;
+        return PerfCounter::difference(_prev, _data);
+    }
+
+    /**
+     * Reads the current value of the started counter, e.g., to measure a section.
+     *
+     * @param sample Current value.
+     * @return True, when the counter was read.
+     */
+    bool sample(read_format &sample) const
+    {
+        return ::read(_file_descriptor, &sample, sizeof(read_format)) == sizeof(read_format);
+    }
+
+    /**
+     * @param begin Value at the begin of a measured section.
+     * @param end Value at the end of a measured section.
+     * @return Difference between both values, corrected for multiplexing.
+     */
+    [[nodiscard]] static double difference(const read_format &begin, const read_format &end)
+    {
+        if (end.time_running <= begin.time_running)
+        {
+            return 0.0;
+        }
+
+        const auto multiplexing_correction = static_cast<double>(end.time_enabled - begin.time_enabled) /
+                                             static_cast<double>(end.time_running - begin.time_running);
+        return static_cast<double>(end.value - begin.value) * multiplexing_correction;
     }
 
     [[nodiscard]] const std::string &name() const
@@ -108,13 +172,6 @@ class PerfCounter
     }
 
   private:
-    struct read_format
-    {
-        std::uint64_t value = 0;
-        std::uint64_t time_enabled = 0;
-        std::uint64_t time_running = 0;
-    };
-
     const std::string _name;
     std::int32_t _file_descriptor = -1;
     perf_event_attr _perf_event_attribute{};
@@ -143,11 +200,18 @@ class Perf
     Perf() noexcept = default;
     ~Perf() noexcept = default;
 
-    bool add(PerfCounter &counter_)
+    /**
+     * Opens a copy of the given counter for the calling thread.
+     *
+     * @param counter_ Definition of the counter (e.g., Perf::CYCLES).
+     * @return True, when the counter is supported and permitted.
+     */
+    bool add(const PerfCounter &counter_)
     {
-        if (counter_.open())
+        auto opened_counter = PerfCounter{counter_};
+        if (opened_counter.open())
         {
-            _counter.push_back(counter_);
+            _counter.push_back(std::move(opened_counter));
             return true;
         }
 
@@ -181,11 +245,35 @@ class Perf
         return 0.0;
     }
 
+    /**
+     * Reads the current values of all started counters.
+     *
+     * @param samples Values, one per counter.
+     */
+    void sample(std::vector<PerfCounter::read_format> &samples) const
+    {
+        samples.resize(_counter.size());
+        for (auto i = 0u; i < _counter.size(); ++i)
+        {
+            _counter[i].sample(samples[i]);
+        }
+    }
+
     std::vector<PerfCounter> &counter()
     {
         return _counter;
     }
 
+    [[nodiscard]] const std::vector<PerfCounter> &counter() const
+    {
+        return _counter;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return _counter.empty();
+    }
+
   private:
     std::vector<PerfCounter> _counter;
 };
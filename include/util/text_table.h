@@ -23,6 +23,7 @@
 #pragma once
 #include <algorithm>
 #include <cstdint>
+#include <optional>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -36,6 +37,7 @@ namespace beedb::util
 class TextTable
 {
     friend std::ostream &operator<<(std::ostream &stream, const TextTable &text_table);
+    friend class StreamingTextTable;
 
   public:
     TextTable() = default;
@@ -112,4 +114,117 @@ class TextTable
     static std::ostream &print_row(std::ostream &stream, const std::vector<std::size_t> &column_lengths,
                                    const std::vector<std::string> &row);
 };
+
+/**
+ * Prints rows as soon as they are added, instead of collecting all
+ * rows first. As table, the column widths are taken from the given
+ * (schema-based) lengths, or from the first rows that are held back
+ * until the widths are known; later (wider) values are printed in full.
+ * As CSV or TSV, rows are printed immediately, e.g., for piping.
+ */
+class StreamingTextTable
+{
+  public:
+    enum Format
+    {
+        Table,
+        CSV,
+        TSV
+    };
+
+    /**
+     * @param name Name of the format (table, csv, or tsv).
+     * @return The format, or nothing when the name is unknown.
+     */
+    [[nodiscard]] static std::optional<Format> format(const std::string &name);
+
+    /**
+     * @param stream Stream the rows are printed to.
+     * @param format Output format.
+     * @param count_sample_rows Number of rows held back to calculate the column widths
+     *                          of a table; zero to use the given lengths only.
+     */
+    StreamingTextTable(std::ostream &stream, const Format format, const std::size_t count_sample_rows)
+        : _stream(stream), _format(format), _count_sample_rows(count_sample_rows)
+    {
+    }
+
+    ~StreamingTextTable() = default;
+
+    /**
+     * Starts a new table.
+     *
+     * @param row_values Header values.
+     * @param column_lengths Length per column (e.g., the printed length of the column's type),
+     *                       used when no rows are held back.
+     */
+    void header(std::vector<std::string> &&row_values, std::vector<std::size_t> &&column_lengths = {});
+
+    /**
+     * Adds a row to the table, which is printed immediately
+     * or when the column widths are known.
+     *
+     * @param row_values Row.
+     */
+    void push_back(std::vector<std::string> &&row_values);
+
+    /**
+     * Prints all rows held back and finishes the table.
+     */
+    void flush();
+
+    /**
+     * Drops the table (and all rows held back) without finishing it.
+     */
+    void clear();
+
+    /**
+     * @return True, when no table was started.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _header.empty();
+    }
+
+    [[nodiscard]] Format format() const
+    {
+        return _format;
+    }
+
+  private:
+    std::ostream &_stream;
+    const Format _format;
+    const std::size_t _count_sample_rows;
+
+    std::vector<std::string> _header;
+    std::vector<std::vector<std::string>> _sample_rows;
+    std::vector<std::size_t> _column_lengths;
+
+    // True, when the header was printed and rows are printed immediately.
+    bool _is_printing = false;
+
+    /**
+     * Calculates the column widths and prints the header and all rows held back.
+     */
+    void start();
+
+    /**
+     * Prints a single row in the table's format.
+     *
+     * @param row The row that should be printed.
+     */
+    void print(const std::vector<std::string> &row);
+
+    /**
+     * Escapes a value for CSV: Values containing separators, quotes, or
+     * line breaks are quoted, quotes within are doubled.
+     */
+    [[nodiscard]] static std::string escape_csv(const std::string &value);
+
+    /**
+     * Escapes a value for TSV: Tabs, line breaks, and backslashes are
+     * replaced by escape sequences.
+     */
+    [[nodiscard]] static std::string escape_tsv(const std::string &value);
+};
 } // namespace beedb::util
\ No newline at end of file
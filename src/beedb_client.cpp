@@ -31,6 +31,12 @@ int main(int arg_count, char **args)
         .help("Port of the server")
         .default_value(std::uint16_t(4000))
         .action([](const std::string &value) { return std::uint16_t(std::stoul(value)); });
+    argument_parser.add_argument("-f", "--format")
+        .help("Format of results sent by the server: rows, columns, or compressed")
+        .default_value(std::string("columns"));
+    argument_parser.add_argument("-o", "--output")
+        .help("Format of printed results: table, csv, or tsv")
+        .default_value(std::string("table"));
     try
     {
         argument_parser.parse_args(arg_count, args);
@@ -41,7 +47,15 @@ int main(int arg_count, char **args)
         return 1;
     }
 
+    const auto output_format = beedb::util::StreamingTextTable::format(argument_parser.get<std::string>("-o"));
+    if (output_format.has_value() == false)
+    {
+        argument_parser.print_help();
+        return 1;
+    }
+
     auto server_address = argument_parser.get<std::string>("host");
-    auto client = beedb::io::ClientConsole{std::move(server_address), argument_parser.get<std::uint16_t>("-p")};
+    auto client = beedb::io::ClientConsole{std::move(server_address), argument_parser.get<std::uint16_t>("-p"),
+                                           argument_parser.get<std::string>("-f"), output_format.value()};
     client.run();
 }
\ No newline at end of file
@@ -22,8 +22,10 @@
 
 #include <argparse/argparse.hpp>
 #include <chrono>
+#include <cmath>
 #include <config.h>
 #include <database.h>
+#include <exception/disk_exception.h>
 #include <io/client_console.h>
 #include <io/client_handler.h>
 #include <io/command/commander.h>
@@ -51,6 +53,12 @@ int main(int arg_count, char **args)
     const auto enable_hash_join = ini_parser.get<bool>("optimizer", "enable-hash-join", false);
     const auto enable_predicate_push_down = ini_parser.get<bool>("optimizer", "enable-predicate-push-down", false);
     const auto print_statistics = ini_parser.get<bool>("executor", "print-statistics", false);
+    const auto statement_timeout = ini_parser.get<std::uint32_t>("executor", "statement-timeout", 0u);
+    const auto perf_counters = ini_parser.get<bool>("executor", "perf-counters", false);
+    const auto analyze_sample_pages = ini_parser.get<std::uint32_t>("statistics", "analyze-sample-pages", 64u);
+    const auto auto_analyze_threshold = ini_parser.get<std::uint32_t>("statistics", "auto-analyze-threshold", 0u);
+    const auto checkpoint_interval = ini_parser.get<std::uint32_t>("recovery", "checkpoint-interval", 60u);
+    const auto workers = ini_parser.get<std::uint32_t>("server", "workers", 0u);
 
     // Parse command line arguments
     auto argument_parser = argparse::ArgumentParser{"beedb"};
@@ -63,6 +71,9 @@ int main(int arg_count, char **args)
         .action([](const std::string &value) { return std::uint16_t(std::stoul(value)); });
     argument_parser.add_argument("-l", "--load").help("Load SQL file into database.").default_value(std::string(""));
     argument_parser.add_argument("-q", "--query").help("Execute Query.").default_value(std::string(""));
+    argument_parser.add_argument("-o", "--output")
+        .help("Format the result of the query is printed in: table, csv, or tsv")
+        .default_value(std::string("table"));
     argument_parser.add_argument("-cmd", "--custom_command")
         .help("Execute custom command and exit right after.")
         .default_value(std::string(""));
@@ -98,6 +109,30 @@ int main(int arg_count, char **args)
         .help("Print all execution statistics")
         .implicit_value(true)
         .default_value(print_statistics);
+    argument_parser.add_argument("--statement-timeout")
+        .help("Milliseconds a statement may run before it is cancelled (0 to disable).")
+        .default_value(statement_timeout)
+        .action([](const std::string &value) { return std::uint32_t(std::stoi(value)); });
+    argument_parser.add_argument("--perf-counters")
+        .help("Collect hardware performance counters per query and per operator.")
+        .implicit_value(true)
+        .default_value(perf_counters);
+    argument_parser.add_argument("--analyze-sample-pages")
+        .help("Number of pages ANALYZE samples per table (0 for all pages).")
+        .default_value(analyze_sample_pages)
+        .action([](const std::string &value) { return std::uint32_t(std::stoi(value)); });
+    argument_parser.add_argument("--auto-analyze-threshold")
+        .help("Number of modified rows after which a table is analyzed in the background (0 to disable).")
+        .default_value(auto_analyze_threshold)
+        .action([](const std::string &value) { return std::uint32_t(std::stoi(value)); });
+    argument_parser.add_argument("--checkpoint-interval")
+        .help("Seconds between two checkpoints (0 to disable).")
+        .default_value(checkpoint_interval)
+        .action([](const std::string &value) { return std::uint32_t(std::stoi(value)); });
+    argument_parser.add_argument("--workers")
+        .help("Number of threads handling client queries (0 for one per core).")
+        .default_value(std::uint16_t(workers))
+        .action([](const std::string &value) { return std::uint16_t(std::stoul(value)); });
 
     try
     {
@@ -147,15 +182,34 @@ int main(int arg_count, char **args)
                true); // true (at first), to disable optimization during boot
     config.set(beedb::Config::k_CheckFinalPlan, false);
     config.set(beedb::Config::k_PrintExecutionStatistics, argument_parser.get<bool>("--stats"));
+    config.set(beedb::Config::k_StatementTimeout, argument_parser.get<std::uint32_t>("--statement-timeout"));
+    config.set(beedb::Config::k_PerfCounters, argument_parser.get<bool>("--perf-counters"));
+    config.set(beedb::Config::k_AnalyzeSamplePages, argument_parser.get<std::uint32_t>("--analyze-sample-pages"));
+    config.set(beedb::Config::k_AutoAnalyzeThreshold, argument_parser.get<std::uint32_t>("--auto-analyze-threshold"));
+    config.set(beedb::Config::k_CheckpointInterval, argument_parser.get<std::uint32_t>("--checkpoint-interval"));
 
     const auto database_file_name = argument_parser.get<std::string>("db-file");
     const auto sql_file = argument_parser.get<std::string>("-l");
     const auto query = argument_parser.get<std::string>("-q");
     const auto keep = argument_parser.get<bool>("-k");
     const auto custom_command = argument_parser.get<std::string>("-cmd");
+    const auto output_format = beedb::util::StreamingTextTable::format(argument_parser.get<std::string>("-o"));
+    if (output_format.has_value() == false)
+    {
+        argument_parser.print_help();
+        return 1;
+    }
 
     auto database = beedb::Database{config, database_file_name};
-    database.boot();
+    try
+    {
+        database.boot();
+    }
+    catch (beedb::exception::DiskException &exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
 
     // re-enable optimization for user-queries, after boot code ran:
     config.set(beedb::Config::k_OptimizationDisableOptimization, false);
@@ -173,19 +227,27 @@ int main(int arg_count, char **args)
 
     if (query.empty() == false)
     {
-        auto result_formatter = beedb::io::ResultOutputFormatter{};
+        // Rows are printed while the query runs, the statistics go to stderr for CSV and TSV.
+        auto result_formatter = beedb::io::StreamingResultOutputFormatter{std::cout, output_format.value()};
         auto executor = beedb::io::Executor{database, nullptr};
         auto result = executor.execute(beedb::io::Query{query}, result_formatter);
         if (result.error().empty() == false)
         {
+            result_formatter.clear();
             std::cerr << result.error() << std::endl;
         }
         else if (result_formatter.empty() == false)
         {
-            std::cout << result_formatter << std::endl;
-            std::cout << "Fetched \033[1;32m" << result.count_tuples() << "\033[0m row"
-                      << (result.count_tuples() == 1U ? "" : "s") << " in \033[1;33m" << result.execution_time().count()
-                      << "\033[0m ms." << std::endl;
+            result_formatter.flush();
+            auto &statistics_stream =
+                output_format.value() == beedb::util::StreamingTextTable::Table ? std::cout : std::cerr;
+            statistics_stream << "Fetched \033[1;32m" << result.count_tuples() << "\033[0m row"
+                              << (result.count_tuples() == 1U ? "" : "s") << " in \033[1;33m"
+                              << result.execution_time().count() << "\033[0m ms." << std::endl;
+            for (const auto &[name, value] : result.performance_counters())
+            {
+                statistics_stream << name << ": " << std::llround(value) << std::endl;
+            }
         }
     }
 
@@ -215,7 +277,12 @@ int main(int arg_count, char **args)
 
     const auto port = argument_parser.get<std::uint16_t>("-p");
     auto client_handler = beedb::io::ClientHandler{database};
-    auto server = beedb::network::Server{client_handler, port};
+    auto count_workers = argument_parser.get<std::uint16_t>("--workers");
+    if (count_workers == 0u)
+    {
+        count_workers = static_cast<std::uint16_t>(std::thread::hardware_concurrency());
+    }
+    auto server = beedb::network::Server{client_handler, port, count_workers};
 
     if (argument_parser.get<bool>("-c"))
     {
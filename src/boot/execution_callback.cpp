@@ -86,4 +86,21 @@ void StatisticExecutionCallback::on_tuple(const table::Tuple &tuple)
     const auto table_id = tuple.get(0).get<std::int32_t>();
     const auto cardinality = tuple.get(1).get<std::int64_t>();
     this->_system_statistics.table_statistics().cardinality(table_id, cardinality);
-}
\ No newline at end of file
+}
+
+void ColumnStatisticExecutionCallback::on_tuple(const table::Tuple &tuple)
+{
+    const auto column_id = tuple.get(0).get<std::int32_t>();
+    const auto null_fraction = tuple.get(1).get<double>();
+    const auto count_distinct = tuple.get(2).get<std::int64_t>();
+    const auto min = tuple.get(3).get<double>();
+    const auto max = tuple.get(4).get<double>();
+    const auto most_common_values = tuple.get(5).get<std::string_view>();
+    const auto histogram = tuple.get(6).get<std::string_view>();
+
+    this->_system_statistics.column_statistics().statistic(
+        column_id, statistic::ColumnStatistic{
+                       null_fraction, std::uint64_t(count_distinct), min, max,
+                       statistic::ColumnStatistic::most_common_values_from_string(std::string{most_common_values}),
+                       statistic::EquiDepthHistogram::from_string(std::string{histogram})});
+}
@@ -28,9 +28,11 @@
 
 using namespace beedb::buffer;
 
+thread_local Manager::AccessStatistics Manager::_access_statistics{};
+
 Manager::Manager(std::size_t count_frames, beedb::storage::Manager &space_manager,
-                 std::unique_ptr<ReplacementStrategy> &&replacement_strategy)
-    : _space_manager(space_manager), _replacement_strategy(std::move(replacement_strategy))
+                 recovery::LogManager &log_manager, std::unique_ptr<ReplacementStrategy> &&replacement_strategy)
+    : _space_manager(space_manager), _log_manager(log_manager), _replacement_strategy(std::move(replacement_strategy))
 {
     _frames.resize(count_frames);
 }
@@ -55,8 +57,11 @@ beedb::storage::Page *Manager::pin(beedb::storage::Page::id_t page_id)
 
     const auto page_iterator = this->frame_information(page_id);
     const bool is_frame_buffered = page_iterator != this->_frames.end();
+    Manager::_access_statistics.count_pins++;
     if (is_frame_buffered)
     {
+        Manager::_access_statistics.count_hits++;
+
         auto &page = *page_iterator;
         // Update frame information.
         page.pin_count(page.pin_count() + 1u);
@@ -66,6 +71,8 @@ beedb::storage::Page *Manager::pin(beedb::storage::Page::id_t page_id)
     }
     else
     {
+        Manager::_access_statistics.count_misses++;
+
         // Find frame for the pinned page.
         auto frame_index = this->_evicted_frames++;
         if (frame_index >= this->_frames.size())
@@ -82,12 +89,13 @@ beedb::storage::Page *Manager::pin(beedb::storage::Page::id_t page_id)
         // Write frame back, if the data was modified.
         if (page.is_dirty() == true)
         {
-            this->_space_manager.write(page.id(), page.data());
+            this->write_back(page);
         }
-        
+
         // Load page into frame.
         page.id(page_id);
         page.is_dirty(false);
+        page.reset_lsn();
         page.pin_count(1u);
         this->_space_manager.read(page_id, page.data());
 
@@ -126,12 +134,59 @@ void Manager::flush()
         // Write back, when the frame is dirty.
         if (page.id() != storage::Page::INVALID_PAGE_ID && page.is_dirty())
         {
-            this->_space_manager.write(page.id(), page.data());
-            page.is_dirty(false);
+            this->write_back(page);
+        }
+    }
+}
+
+void Manager::write_through(storage::Page *page)
+{
+    std::lock_guard _{this->_latch};
+    this->write_back(*page);
+}
+
+void Manager::write_back_dirty_pages(const std::uint64_t recovery_lsn)
+{
+    std::lock_guard _{this->_latch};
+
+    for (auto &page : this->_frames)
+    {
+        if (page.id() != storage::Page::INVALID_PAGE_ID && page.is_dirty() && page.is_pinned() == false &&
+            page.recovery_lsn() < recovery_lsn)
+        {
+            this->write_back(page);
         }
     }
 }
 
+std::vector<std::pair<beedb::storage::Page::id_t, std::uint64_t>> Manager::dirty_pages()
+{
+    std::lock_guard _{this->_latch};
+
+    std::vector<std::pair<storage::Page::id_t, std::uint64_t>> dirty_pages;
+    for (const auto &page : this->_frames)
+    {
+        // Pages may be changed (and logged) while pinned, before they are unpinned as dirty.
+        if (page.id() != storage::Page::INVALID_PAGE_ID && page.recovery_lsn() > 0u)
+        {
+            dirty_pages.emplace_back(page.id(), page.recovery_lsn());
+        }
+    }
+
+    return dirty_pages;
+}
+
+void Manager::write_back(storage::Page &page)
+{
+    if (page.lsn() > 0u)
+    {
+        this->_log_manager.flush(page.lsn());
+    }
+    this->_space_manager.write(page.id(), page.data());
+    page.is_dirty(false);
+    page.reset_lsn();
+}
+
 std::vector<beedb::storage::Page>::iterator Manager::frame_information(storage::Page::id_t page_id)
 {
     return std::find_if(this->_frames.begin(), this->_frames.end(),
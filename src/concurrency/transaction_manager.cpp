@@ -20,12 +20,14 @@
  *------------------------------------------------------------------------------*
  */
 
+#include <algorithm>
 #include <concurrency/transaction_manager.h>
-#include <unordered_set>
+#include <iterator>
 
 using namespace beedb::concurrency;
 
-TransactionManager::TransactionManager(buffer::Manager &buffer_manager) : _buffer_manager(buffer_manager)
+TransactionManager::TransactionManager(buffer::Manager &buffer_manager, recovery::LogManager &log_manager)
+    : _buffer_manager(buffer_manager), _log_manager(log_manager)
 {
 }
 
@@ -35,75 +37,214 @@ TransactionManager::~TransactionManager()
     {
         delete transaction;
     }
+
+    for (auto [_, transaction] : this->_retired_transactions)
+    {
+        delete transaction;
+    }
+}
+
+Transaction *TransactionManager::new_transaction(const IsolationLevel isolation_level, const bool is_read_only)
+{
+    // The begin timestamp is taken under the latch, so the garbage collection
+    // never sees a timestamp handed out but not yet registered as active.
+    std::unique_lock _{this->_active_transactions_latch};
+    const auto begin_time = this->_next_timestamp.fetch_add(1u);
+    this->_active_transactions.insert(begin_time);
+    return new Transaction(isolation_level, timestamp(begin_time, false), is_read_only);
+}
+
+void TransactionManager::end(const Transaction &transaction)
+{
+    std::unique_lock _{this->_active_transactions_latch};
+    this->_active_transactions.erase(transaction.begin_timestamp().time());
 }
 
-Transaction *TransactionManager::new_transaction(const IsolationLevel isolation_level)
+beedb::concurrency::timestamp::timestamp_t TransactionManager::oldest_active_timestamp()
 {
-    return new Transaction(isolation_level, timestamp(this->_next_timestamp.fetch_add(1u), false));
+    std::unique_lock _{this->_active_transactions_latch};
+    if (this->_active_transactions.empty())
+    {
+        return this->_next_timestamp.load();
+    }
+
+    return *this->_active_transactions.begin();
+}
+
+void TransactionManager::collect_garbage()
+{
+    const auto oldest_active_time = this->oldest_active_timestamp();
+
+    std::vector<Transaction *> reclaimable_transactions;
+    std::vector<std::function<void(timestamp::timestamp_t)>> reclaim_actions;
+    {
+        std::unique_lock _{this->_commit_history_latch};
+
+        // Transactions retired in an earlier epoch are no longer referenced,
+        // when all transactions running at their retirement have ended.
+        while (this->_retired_transactions.empty() == false &&
+               this->_retired_transactions.front().first < oldest_active_time)
+        {
+            // Transactions still owned are deleted on release.
+            auto *transaction = this->_retired_transactions.front().second;
+            if (transaction->dereference())
+            {
+                reclaimable_transactions.emplace_back(transaction);
+            }
+            this->_retired_transactions.pop_front();
+        }
+
+        // Validation only checks transactions committed after the validating transaction began.
+        // Those transactions do not see the versions replaced by the retired ones, either.
+        const auto epoch = this->_next_timestamp.load();
+        while (this->_commit_history.empty() == false && this->_commit_history.front().first < oldest_active_time)
+        {
+            auto *transaction = this->_commit_history.front().second;
+            for (auto &action : transaction->take_reclaim_actions())
+            {
+                reclaim_actions.emplace_back(std::move(action));
+            }
+            this->_retired_transactions.emplace_back(epoch, transaction);
+            this->_commit_history.pop_front();
+        }
+    }
+
+    for (const auto &action : reclaim_actions)
+    {
+        action(oldest_active_time);
+    }
+
+    for (auto *transaction : reclaimable_transactions)
+    {
+        delete transaction;
+    }
+}
+
+void TransactionManager::release(Transaction *transaction)
+{
+    auto is_referenced = true;
+    {
+        std::unique_lock _{this->_commit_history_latch};
+        is_referenced = transaction->dereference() == false;
+    }
+
+    if (is_referenced == false)
+    {
+        delete transaction;
+    }
 }
 
 bool TransactionManager::commit(Transaction &transaction)
 {
+    // A read-only transaction saw a consistent snapshot and wrote nothing
+    // concurrent transactions could conflict with; it needs neither validation
+    // nor a place in the commit history.
+    if (transaction.is_read_only())
+    {
+        transaction.committed();
+        this->end(transaction);
+        {
+            std::unique_lock _{this->_commit_history_latch};
+            transaction.reference();
+            this->_retired_transactions.emplace_back(this->_next_timestamp.load(), &transaction);
+        }
+        this->collect_garbage();
+        return true;
+    }
+
     const auto commit_time = this->_next_timestamp.fetch_add(1u);
     transaction.commit_timestamp(timestamp{commit_time, true});
 
     if (this->validate(transaction))
     {
-        // Enter write phase.
-        for (const auto &write_set_item : transaction.write_set())
-        {
-            if (write_set_item == WriteSetItem::Inserted)
+        // Inserted records and new versions of updated records begin with the commit,
+        // deleted records and old versions of updated records end with the commit.
+        const auto writes = TransactionManager::page_ordered_writes(transaction);
+        const auto stamp = [&transaction](Metadata *metadata, const storage::RecordIdentifier record_identifier,
+                                          const WriteSetItem *write_set_item) {
+            const auto is_in_place = record_identifier == write_set_item->in_place_record_identifier();
+            if (is_in_place && (*write_set_item == WriteSetItem::Deleted) == false)
             {
-                const auto record_identifier = write_set_item.in_place_record_identifier();
-                auto *page =
-                    reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(record_identifier.page_id()));
-                const auto &slot = page->slot(record_identifier.slot());
-                auto *metadata = reinterpret_cast<Metadata *>((*page)[slot.start()]);
                 metadata->begin_timestamp(transaction.commit_timestamp());
-                this->_buffer_manager.unpin(page, true);
             }
-            else if (write_set_item == WriteSetItem::Updated)
+            else
+            {
+                metadata->end_timestamp(transaction.commit_timestamp());
+            }
+        };
+
+        // Enter write phase: The committed images are logged and summarized; the summary
+        // is published with the commit history. The records keep their timestamps until
+        // the commit is durable, so no transaction reads a write that may get lost.
+        transaction.write_set_summary().reserve(transaction.write_set().size());
+        auto page = PinnedPage{this->_buffer_manager};
+        for (const auto &[record_identifier, write_set_item] : writes)
+        {
+            auto *record_page = page.get(record_identifier.page_id());
+            const auto &slot = record_page->slot(record_identifier.slot());
+            const auto *record = (*record_page)[slot.start()];
+            auto image = std::vector<std::byte>{record, record + slot.size()};
+            stamp(reinterpret_cast<Metadata *>(image.data()), record_identifier, write_set_item);
+
+            this->log_write(transaction, record_page, record_identifier, image);
+            if (record_identifier == write_set_item->in_place_record_identifier())
             {
-                const auto record_identifier = write_set_item.in_place_record_identifier();
-                const auto outdated_record_identifier = write_set_item.old_version_record_identifier();
+                transaction.write_set_summary().add(write_set_item->table_id(), record_identifier, image.data(),
+                                                    image.size());
+            }
+        }
+        page.release();
+        transaction.write_set_summary().seal();
 
-                // Commit updated record
-                {
-                    auto *page =
-                        reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(record_identifier.page_id()));
-                    const auto &slot = page->slot(record_identifier.slot());
-                    auto *metadata = reinterpret_cast<Metadata *>((*page)[slot.start()]);
-                    metadata->begin_timestamp(transaction.commit_timestamp());
-                    this->_buffer_manager.unpin(page, true);
-                }
+        // Record commit history. Commit times are handed out before validation,
+        // so a slower transaction may have to be placed before the latest entries.
+        {
+            std::unique_lock _{this->_commit_history_latch};
+            auto position = this->_commit_history.end();
+            while (position != this->_commit_history.begin() && std::prev(position)->first > commit_time)
+            {
+                --position;
+            }
+            transaction.reference();
+            this->_commit_history.insert(position, std::make_pair(commit_time, &transaction));
+        }
 
-                // Commit old record
-                {
-                    auto *page = reinterpret_cast<storage::RecordPage *>(
-                        this->_buffer_manager.pin(outdated_record_identifier.page_id()));
-                    const auto &slot = page->slot(record_identifier.slot());
-                    auto *metadata = reinterpret_cast<Metadata *>((*page)[slot.start()]);
-                    metadata->end_timestamp(transaction.commit_timestamp());
-                    this->_buffer_manager.unpin(page, true);
-                }
+        // The transaction is durable once its commit record is flushed.
+        // Concurrent commits share a single flush of the log (group commit).
+        if (transaction.write_set().empty() == false)
+        {
+            try
+            {
+                const auto commit_lsn = this->_log_manager.append(
+                    recovery::LogRecord::make_commit(transaction.begin_timestamp().time(), commit_time));
+                this->_log_manager.flush(commit_lsn);
             }
-            else if (write_set_item == WriteSetItem::Deleted)
+            catch (...)
             {
-                const auto record_identifier = write_set_item.in_place_record_identifier();
-                auto *page =
-                    reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(record_identifier.page_id()));
-                const auto &slot = page->slot(record_identifier.slot());
-                auto *metadata = reinterpret_cast<Metadata *>((*page)[slot.start()]);
-                metadata->end_timestamp(transaction.commit_timestamp());
-                this->_buffer_manager.unpin(page, true);
+                // The commit may be lost; the transaction is withdrawn from the history and undone.
+                {
+                    std::unique_lock _{this->_commit_history_latch};
+                    this->_commit_history.erase(std::find(this->_commit_history.begin(), this->_commit_history.end(),
+                                                          std::make_pair(commit_time, &transaction)));
+                    static_cast<void>(transaction.dereference());
+                }
+                this->abort(transaction);
+                throw;
             }
         }
 
-        // Record commit history.
+        // Publish the writes.
+        for (const auto &[record_identifier, write_set_item] : writes)
         {
-            std::unique_lock _{this->_commit_history_latch};
-            this->_commit_history.insert({commit_time, &transaction});
+            auto *record_page = page.get(record_identifier.page_id());
+            const auto &slot = record_page->slot(record_identifier.slot());
+            stamp(reinterpret_cast<Metadata *>((*record_page)[slot.start()]), record_identifier, write_set_item);
         }
+        page.release();
+
+        transaction.committed();
+        this->end(transaction);
+        this->collect_garbage();
 
         return true;
     }
@@ -114,52 +255,145 @@ bool TransactionManager::commit(Transaction &transaction)
     }
 }
 
-void TransactionManager::abort(Transaction &transaction)
+std::vector<std::pair<beedb::storage::RecordIdentifier, const WriteSetItem *>> TransactionManager::
+    page_ordered_writes(const Transaction &transaction)
 {
+    std::vector<std::pair<storage::RecordIdentifier, const WriteSetItem *>> writes;
+    writes.reserve(transaction.write_set().size());
     for (const auto &write_set_item : transaction.write_set())
     {
-        if (write_set_item == WriteSetItem::Inserted)
+        writes.emplace_back(write_set_item.in_place_record_identifier(), &write_set_item);
+    }
+
+    // Old versions follow all in-place records.
+    const auto count_in_place_writes = writes.size();
+    for (const auto &write_set_item : transaction.write_set())
+    {
+        if (write_set_item == WriteSetItem::Updated)
         {
-            const auto record_identifier = write_set_item.in_place_record_identifier();
-            auto *page =
-                reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(record_identifier.page_id()));
-            auto &slot = page->slot(record_identifier.slot());
-            slot.is_free(true);
-            this->_buffer_manager.unpin(page, true);
+            writes.emplace_back(write_set_item.old_version_record_identifier(), &write_set_item);
         }
-        else if (write_set_item == WriteSetItem::Updated)
-        {
-            auto *time_travel_page = reinterpret_cast<storage::RecordPage *>(
-                this->_buffer_manager.pin(write_set_item.old_version_record_identifier().page_id()));
-            auto *in_place_page = reinterpret_cast<storage::RecordPage *>(
-                this->_buffer_manager.pin(write_set_item.in_place_record_identifier().page_id()));
+    }
 
-            auto &time_travel_slot = time_travel_page->slot(write_set_item.old_version_record_identifier().slot());
-            const auto &in_place_slot = in_place_page->slot(write_set_item.in_place_record_identifier().slot());
+    const auto compare = [](const auto &left, const auto &right) {
+        return left.first.page_id() < right.first.page_id();
+    };
+    std::stable_sort(writes.begin(), writes.begin() + count_in_place_writes, compare);
+    std::stable_sort(writes.begin() + count_in_place_writes, writes.end(), compare);
 
-            // Overwrite in place record.
-            auto metadata = Metadata{*reinterpret_cast<Metadata *>((*time_travel_page)[time_travel_slot.start()])};
-            metadata.end_timestamp(timestamp::make_infinity());
-            in_place_page->write(write_set_item.in_place_record_identifier().slot(), &metadata,
-                                 (*time_travel_page)[time_travel_slot.start() + sizeof(Metadata)],
-                                 write_set_item.written_size());
-            this->_buffer_manager.unpin(in_place_page, true);
+    return writes;
+}
 
-            // Free slot in time travel space.
-            time_travel_slot.is_free(true);
-            this->_buffer_manager.unpin(time_travel_page, true);
+beedb::storage::RecordPage *TransactionManager::PinnedPage::get(const storage::Page::id_t page_id)
+{
+    if (this->_page != nullptr && this->_page->id() == page_id)
+    {
+        return this->_page;
+    }
+
+    this->release();
+    this->_page = reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(page_id));
+    return this->_page;
+}
+
+void TransactionManager::PinnedPage::release()
+{
+    if (this->_page != nullptr)
+    {
+        this->_buffer_manager.unpin(this->_page, true);
+        this->_page = nullptr;
+    }
+}
+
+void TransactionManager::log_write(const Transaction &transaction, storage::RecordPage *page,
+                                   const storage::RecordIdentifier record_identifier,
+                                   const std::vector<std::byte> &image)
+{
+    const auto &slot = page->slot(record_identifier.slot());
+    page->lsn(this->_log_manager.append(recovery::LogRecord::make_write(
+        transaction.begin_timestamp().time(), transaction.commit_timestamp().time(), record_identifier, slot.start(),
+        image.data(), std::uint16_t(image.size()))));
+}
+
+void TransactionManager::log_compensation(const Transaction &transaction, storage::RecordPage *page,
+                                          const storage::RecordIdentifier record_identifier)
+{
+    const auto &slot = page->slot(record_identifier.slot());
+    if (slot.is_free())
+    {
+        page->lsn(this->_log_manager.append(recovery::LogRecord::make_compensation(
+            transaction.begin_timestamp().time(), record_identifier, slot.start())));
+    }
+    else
+    {
+        page->lsn(this->_log_manager.append(
+            recovery::LogRecord::make_compensation(transaction.begin_timestamp().time(), record_identifier,
+                                                   slot.start(), (*page)[slot.start()], slot.size())));
+    }
+}
+
+void TransactionManager::abort(Transaction &transaction)
+{
+    // A transaction may be aborted by a failed statement and again by its owner; writes are undone once.
+    if (transaction.is_aborted())
+    {
+        return;
+    }
+    transaction.is_aborted(true);
+
+    // In-place records are restored before the old versions they are restored from are freed.
+    auto page = PinnedPage{this->_buffer_manager};
+    auto time_travel_page = PinnedPage{this->_buffer_manager};
+    for (const auto &[record_identifier, write_set_item] : TransactionManager::page_ordered_writes(transaction))
+    {
+        auto *record_page = page.get(record_identifier.page_id());
+        if (*write_set_item == WriteSetItem::Inserted)
+        {
+            record_page->slot(record_identifier.slot()).is_free(true);
         }
-        else if (write_set_item == WriteSetItem::Deleted)
+        else if (*write_set_item == WriteSetItem::Deleted)
         {
-            const auto record_identifier = write_set_item.in_place_record_identifier();
-            auto *page =
-                reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(record_identifier.page_id()));
-            const auto &slot = page->slot(record_identifier.slot());
-            auto *metadata = reinterpret_cast<Metadata *>((*page)[slot.start()]);
+            const auto &slot = record_page->slot(record_identifier.slot());
+            auto *metadata = reinterpret_cast<Metadata *>((*record_page)[slot.start()]);
             metadata->end_timestamp(timestamp::make_infinity());
-            this->_buffer_manager.unpin(page, true);
         }
+        else if (record_identifier == write_set_item->in_place_record_identifier())
+        {
+            // Overwrite in place record; the written size includes the metadata.
+            const auto old_version_record_identifier = write_set_item->old_version_record_identifier();
+            auto *old_version_page = time_travel_page.get(old_version_record_identifier.page_id());
+            const auto &old_version_slot = old_version_page->slot(old_version_record_identifier.slot());
+            auto metadata = Metadata{*reinterpret_cast<Metadata *>((*old_version_page)[old_version_slot.start()])};
+            metadata.end_timestamp(timestamp::make_infinity());
+            record_page->write(record_identifier.slot(), &metadata,
+                               (*old_version_page)[old_version_slot.start() + sizeof(Metadata)],
+                               write_set_item->written_size() - sizeof(Metadata));
+        }
+        else
+        {
+            // Free slot in time travel space.
+            time_travel_page.release();
+            record_page->slot(record_identifier.slot()).is_free(true);
+        }
+
+        this->log_compensation(transaction, record_page, record_identifier);
+    }
+    page.release();
+    time_travel_page.release();
+
+    for (auto index_write = transaction.index_write_set().rbegin(); index_write != transaction.index_write_set().rend();
+         ++index_write)
+    {
+        index_write->undo();
     }
+
+    // Transactions that wrote nothing left nothing in the log.
+    if (transaction.write_set().empty() == false)
+    {
+        this->_log_manager.append(recovery::LogRecord::make_abort(transaction.begin_timestamp().time()));
+    }
+
+    this->end(transaction);
 }
 
 bool TransactionManager::validate(Transaction &transaction)
@@ -172,6 +406,11 @@ bool TransactionManager::validate(Transaction &transaction)
         return true;
     }
 
+    if (transaction.isolation_level() == IsolationLevel::Snapshot)
+    {
+        return TransactionManager::validate_write_write_conflicts(transaction, concurrent_Transactions);
+    }
+
     if (TransactionManager::validate_write_skew_anomalies(transaction, concurrent_Transactions) == false)
     {
         return false;
@@ -188,18 +427,12 @@ bool TransactionManager::validate(Transaction &transaction)
 bool TransactionManager::validate_write_skew_anomalies(Transaction &transaction,
                                                        const std::vector<Transaction *> &concurrent_transactions)
 {
-    std::unordered_set<storage::RecordIdentifier> read_records;
-    read_records.reserve(transaction.read_set().size());
-    for (const auto &read_set_item : transaction.read_set())
-    {
-        read_records.insert(read_set_item.in_place_record_identifier());
-    }
-
     for (auto *concurrent_transaction : concurrent_transactions)
     {
-        for (const auto &write_set_item : concurrent_transaction->write_set())
+        const auto &summary = concurrent_transaction->write_set_summary();
+        for (const auto &read_set_item : transaction.read_set())
         {
-            if (read_records.find(write_set_item.in_place_record_identifier()) != read_records.end())
+            if (summary.contains(read_set_item.in_place_record_identifier()))
             {
                 return false;
             }
@@ -209,27 +442,38 @@ bool TransactionManager::validate_write_skew_anomalies(Transaction &transaction,
     return true;
 }
 
-bool TransactionManager::validate_scan_set(Transaction &transaction,
-                                           const std::vector<Transaction *> &concurrent_transactions)
+bool TransactionManager::validate_write_write_conflicts(Transaction &transaction,
+                                                       const std::vector<Transaction *> &concurrent_transactions)
 {
-    std::unordered_map<table::Table::id_t, std::vector<WriteSetItem>> possible_conflict_map;
     for (auto *concurrent_transaction : concurrent_transactions)
     {
-        for (const auto &write_set_item : concurrent_transaction->write_set())
+        const auto &summary = concurrent_transaction->write_set_summary();
+        for (const auto &write_set_item : transaction.write_set())
         {
-            possible_conflict_map[write_set_item.table_id()].push_back(write_set_item);
+            // Inserted records are new and can not be written concurrently.
+            if ((write_set_item == WriteSetItem::Inserted) == false &&
+                summary.contains(write_set_item.in_place_record_identifier()))
+            {
+                return false;
+            }
         }
     }
 
+    return true;
+}
+
+bool TransactionManager::validate_scan_set(Transaction &transaction,
+                                           const std::vector<Transaction *> &concurrent_transactions)
+{
     for (auto *scan_set_item : transaction.scan_set())
     {
         if (scan_set_item->table().has_value())
         {
             const auto table_id = scan_set_item->table().value().get().id();
-            if (possible_conflict_map.find(table_id) != possible_conflict_map.end())
+            for (auto *concurrent_transaction : concurrent_transactions)
             {
-                const auto &possible_conflicts = possible_conflict_map[table_id];
-                if (this->validate_scan_set_item(scan_set_item, possible_conflicts) == false)
+                auto *images = concurrent_transaction->write_set_summary().images(table_id);
+                if (images != nullptr && TransactionManager::validate_scan_set_item(scan_set_item, *images) == false)
                 {
                     return false;
                 }
@@ -240,22 +484,19 @@ bool TransactionManager::validate_scan_set(Transaction &transaction,
     return true;
 }
 
-bool TransactionManager::validate_scan_set_item(ScanSetItem *scan_set_item, const std::vector<WriteSetItem> &write_set)
+bool TransactionManager::validate_scan_set_item(ScanSetItem *scan_set_item,
+                                                std::vector<WriteSetSummary::Image> &written_images)
 {
-    for (const auto &write_set_item : write_set)
+    if (scan_set_item->predicate() == nullptr)
     {
-        const auto record_identifier = write_set_item.in_place_record_identifier();
-        auto *page = reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(record_identifier.page_id()));
-
-        // Build tuple
-        const auto &slot = page->slot(record_identifier.slot());
-        auto *metadata = reinterpret_cast<Metadata *>((*page)[slot.start()]);
-        auto *data = (*page)[slot.start() + sizeof(Metadata)];
-        auto tuple = table::Tuple(scan_set_item->table().value().get().schema(), record_identifier, metadata, data);
-
-        const auto matches = scan_set_item->predicate() == nullptr || scan_set_item->predicate()->matches(tuple);
-        this->_buffer_manager.unpin(page, false);
-        if (matches)
+        return written_images.empty();
+    }
+
+    const auto &schema = scan_set_item->table().value().get().schema();
+    for (auto &image : written_images)
+    {
+        auto tuple = table::Tuple(schema, image.record_identifier(), image.metadata(), image.data());
+        if (scan_set_item->predicate()->matches(tuple))
         {
             return false;
         }
@@ -269,16 +510,14 @@ std::vector<Transaction *> TransactionManager::committed_transactions(const time
 {
     std::vector<Transaction *> transactions;
 
-    if (begin < end)
+    if (begin <= end)
     {
-        transactions.reserve(end - begin);
         std::shared_lock _{this->_commit_history_latch};
-        for (auto i = begin; i <= end; ++i)
+        const auto compare = [](const auto &entry, const timestamp::timestamp_t time) { return entry.first < time; };
+        auto iterator = std::lower_bound(this->_commit_history.begin(), this->_commit_history.end(), begin, compare);
+        for (; iterator != this->_commit_history.end() && iterator->first <= end; ++iterator)
         {
-            if (this->_commit_history.find(i) != this->_commit_history.end())
-            {
-                transactions.emplace_back(this->_commit_history[i]);
-            }
+            transactions.emplace_back(iterator->second);
         }
     }
 
@@ -20,6 +20,7 @@
  *------------------------------------------------------------------------------*
  */
 
+#include <algorithm>
 #include <boot/execution_callback.h>
 #include <buffer/clock_strategy.h>
 #include <buffer/lfu_strategy.h>
@@ -28,21 +29,27 @@
 #include <buffer/random_strategy.h>
 #include <buffer/replacement_strategy.h>
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <config.h>
 #include <database.h>
+#include <exception/disk_exception.h>
+#include <exception/execution_exception.h>
 #include <index/index_factory.h>
 #include <io/executor.h>
 #include <plan/physical/builder.h>
 #include <sstream>
 #include <storage/metadata_page.h>
 #include <table/column.h>
+#include <util/random_generator.h>
 
 using namespace beedb;
 
 Database::Database(Config &config, const std::string &file_name)
-    : _config(config), _storage_manager(file_name),
-      _buffer_manager(static_cast<std::size_t>(config[Config::k_BufferFrames]), _storage_manager),
-      _table_disk_manager(_buffer_manager), _transaction_manager(_buffer_manager)
+    : _config(config), _storage_manager(file_name), _log_manager(file_name + ".wal"),
+      _buffer_manager(static_cast<std::size_t>(config[Config::k_BufferFrames]), _storage_manager, _log_manager),
+      _table_disk_manager(_buffer_manager, _log_manager), _transaction_manager(_buffer_manager, _log_manager),
+      _recovery_manager(_storage_manager, _buffer_manager, _log_manager)
 {
     // Initialize BufferManagerStrategy.
     const auto count_frames = static_cast<std::size_t>(config[Config::k_BufferFrames]);
@@ -74,12 +81,44 @@ Database::Database(Config &config, const std::string &file_name)
 
 Database::~Database()
 {
-    // Update statistics
+    // Stop analyzing tables in the background.
+    {
+        std::unique_lock _{this->_auto_analyze_latch};
+        this->_is_running = false;
+    }
+    this->_auto_analyze_condition.notify_one();
+    this->_checkpoint_condition.notify_one();
+    if (this->_auto_analyze_thread.joinable())
+    {
+        this->_auto_analyze_thread.join();
+    }
+    if (this->_checkpoint_thread.joinable())
+    {
+        this->_checkpoint_thread.join();
+    }
+
+    // A database that failed to boot (e.g., a file of another format) is not written.
+    if (this->_is_booted == false)
+    {
+        for (auto [_, table] : this->_tables)
+        {
+            delete table;
+        }
+        return;
+    }
+
+    // Update statistics; on failure, the next boot starts with the last persisted statistics.
     for (auto [_, table] : this->_tables)
     {
         if (table->is_virtual() == false)
         {
-            this->persist_table_statistics(table, this->_statistics.table_statistics().cardinality(*table));
+            try
+            {
+                this->persist_table_statistics(table, this->_statistics.table_statistics().cardinality(*table));
+            }
+            catch (exception::DatabaseException &)
+            {
+            }
         }
     }
 
@@ -88,6 +127,9 @@ Database::~Database()
     metadata_page->next_transaction_timestamp(this->_transaction_manager.next_timestamp());
     this->_buffer_manager.unpin(metadata_page, true);
 
+    // Write back all pages; the next boot does not need to recover.
+    this->checkpoint();
+
     // Delete tables AFTER all statistics are persisted.
     // Otherwise, it is possible to delete the statistics table
     // before all updates are done.
@@ -99,17 +141,49 @@ Database::~Database()
 
 void Database::boot()
 {
+    const auto is_new_database = this->_storage_manager.count_pages() == 0u;
+
+    // Files of another format would be misread (e.g., a data page as system page); they are left untouched.
+    if (is_new_database == false)
+    {
+        auto *metadata_page =
+            reinterpret_cast<storage::MetadataPage *>(this->_buffer_manager.pin(SystemPageIds::Metadata));
+        const auto format_version = metadata_page->format_version();
+        this->_buffer_manager.unpin(metadata_page, false);
+        if (format_version != storage::MetadataPage::current_format_version)
+        {
+            throw exception::IncompatibleStorageFormatException{format_version,
+                                                                storage::MetadataPage::current_format_version};
+        }
+    }
+
+    // A log left by a former data file describes pages that do not exist anymore;
+    // replaying it after a crash would corrupt the new database.
+    if (is_new_database)
+    {
+        this->_log_manager.clear();
+    }
+
+    // Repeat everything logged since the latest checkpoint; no-op after a clean shutdown.
+    const auto recovered_timestamp = is_new_database ? concurrency::timestamp::timestamp_t{0u} : this->recover();
+
     // Initialize tables with fixed schema and allocate pages for the data,
     // if the file is empty.
-    this->initialize_database(this->_storage_manager.count_pages() == 0u);
+    this->initialize_database(is_new_database);
 
     // Initialize metadata.
     auto *metadata_page = reinterpret_cast<storage::MetadataPage *>(this->_buffer_manager.pin(SystemPageIds::Metadata));
     const auto next_transaction_timestamp = metadata_page->next_transaction_timestamp();
     this->_buffer_manager.unpin(metadata_page, false);
 
-    // Set from metadata.
-    this->_transaction_manager.next_timestamp(next_transaction_timestamp);
+    // Set from metadata; after a crash, the log may know later timestamps.
+    this->_transaction_manager.next_timestamp(std::max(next_transaction_timestamp, recovered_timestamp + 1u));
+
+    // Make the recovered pages durable.
+    if (is_new_database == false)
+    {
+        this->checkpoint();
+    }
 
     // Read all tables, columns and indices and build tables from the results.
     // After this, we filled Database::_tables map which points from name to physical table.
@@ -124,6 +198,10 @@ void Database::boot()
     auto statistics_executor = io::Executor{*this};
     statistics_executor.execute(io::Query{"select * from system_table_statistics"}, statistic_callback);
 
+    // Read all column statistics.
+    auto column_statistic_callback = boot::ColumnStatisticExecutionCallback{this->_statistics};
+    statistics_executor.execute(io::Query{"select * from system_column_statistics"}, column_statistic_callback);
+
     // Build and fill all indices.
     auto build_index_executor = io::Executor{*this, boot_transaction};
     for (auto &[table_name, table] : this->_tables)
@@ -143,6 +221,74 @@ void Database::boot()
     }
 
     this->_transaction_manager.commit(*boot_transaction);
+    this->_transaction_manager.release(boot_transaction);
+
+    this->_auto_analyze_thread = std::thread{&Database::auto_analyze, this};
+    this->_checkpoint_thread = std::thread{&Database::checkpoint_periodically, this};
+    this->_is_booted = true;
+}
+
+void Database::checkpoint(const recovery::lsn_t recovery_lsn)
+{
+    std::lock_guard _{this->_checkpoint_latch};
+
+    const auto checkpoint_lsn = this->_recovery_manager.checkpoint(recovery_lsn);
+
+    // The checkpoint is complete, when its LSN is on disk.
+    auto *metadata_page = reinterpret_cast<storage::MetadataPage *>(this->_buffer_manager.pin(SystemPageIds::Metadata));
+    metadata_page->checkpoint_lsn(checkpoint_lsn);
+    metadata_page->next_transaction_timestamp(this->_transaction_manager.next_timestamp());
+    this->_buffer_manager.write_through(metadata_page);
+    this->_buffer_manager.unpin(metadata_page, false);
+    this->_storage_manager.sync();
+
+    // Recovery starts at this checkpoint from now on; older records are not needed anymore.
+    this->_log_manager.truncate(checkpoint_lsn);
+
+    this->_checkpoint_lsn = checkpoint_lsn;
+}
+
+beedb::concurrency::timestamp::timestamp_t Database::recover()
+{
+    auto *metadata_page = reinterpret_cast<storage::MetadataPage *>(this->_buffer_manager.pin(SystemPageIds::Metadata));
+    const auto checkpoint_lsn = metadata_page->checkpoint_lsn();
+    this->_buffer_manager.unpin(metadata_page, false);
+
+    return this->_recovery_manager.recover(checkpoint_lsn);
+}
+
+void Database::checkpoint_periodically()
+{
+    while (true)
+    {
+        const auto interval = static_cast<std::uint32_t>(this->_config[Config::k_CheckpointInterval]);
+        {
+            std::unique_lock lock{this->_auto_analyze_latch};
+            const auto wait = [this] { return this->_is_running == false; };
+            if (interval == 0u)
+            {
+                this->_checkpoint_condition.wait(lock, wait);
+            }
+            else
+            {
+                this->_checkpoint_condition.wait_for(lock, std::chrono::seconds{interval}, wait);
+            }
+
+            if (this->_is_running == false)
+            {
+                return;
+            }
+        }
+
+        // Pages dirty since before the previous checkpoint are written back,
+        // so the redo never starts before the previous checkpoint.
+        auto previous_checkpoint_lsn = recovery::lsn_t{0u};
+        {
+            std::lock_guard _{this->_checkpoint_latch};
+            previous_checkpoint_lsn = this->_checkpoint_lsn;
+        }
+        this->checkpoint(previous_checkpoint_lsn);
+    }
 }
 
 void Database::initialize_database(bool create_schema)
@@ -154,6 +300,7 @@ void Database::initialize_database(bool create_schema)
             reinterpret_cast<storage::MetadataPage *>(this->_buffer_manager.allocate<storage::MetadataPage>());
         assert(metadata_page->id() == SystemPageIds::Metadata);
         metadata_page->next_transaction_timestamp(2u);
+        metadata_page->format_version(storage::MetadataPage::current_format_version);
         this->_buffer_manager.unpin(metadata_page, true);
 
         // Allocate page for tables.
@@ -171,10 +318,15 @@ void Database::initialize_database(bool create_schema)
         assert(indices_page->id() == SystemPageIds::Indices);
         this->_buffer_manager.unpin(indices_page, true);
 
-        // Allocate page for indices.
+        // Allocate page for table statistics.
         auto *table_statistics_page = this->_buffer_manager.allocate<storage::RecordPage>();
         assert(table_statistics_page->id() == SystemPageIds::Statistics);
         this->_buffer_manager.unpin(table_statistics_page, true);
+
+        // Allocate page for column statistics.
+        auto *column_statistics_page = this->_buffer_manager.allocate<storage::RecordPage>();
+        assert(column_statistics_page->id() == SystemPageIds::ColumnStatistics);
+        this->_buffer_manager.unpin(column_statistics_page, true);
     }
 
     auto tables_name = std::string{"system_tables"};
@@ -235,10 +387,34 @@ void Database::initialize_database(bool create_schema)
     auto *table_statistics_table = new table::Table(-1, SystemPageIds::Statistics, storage::Page::INVALID_PAGE_ID,
                                                     std::move(table_statistics_schema));
 
+    std::string column_statistics_name("system_column_statistics");
+    table::Schema column_statistics_schema{column_statistics_name};
+    column_statistics_schema.add(table::Column{table::Type::INT, false},
+                                 expression::Term::make_attribute(column_statistics_schema.table_name(), "column_id"));
+    column_statistics_schema.add(
+        table::Column{table::Type::DECIMAL, false},
+        expression::Term::make_attribute(column_statistics_schema.table_name(), "null_fraction"));
+    column_statistics_schema.add(
+        table::Column{table::Type::LONG, false},
+        expression::Term::make_attribute(column_statistics_schema.table_name(), "count_distinct"));
+    column_statistics_schema.add(table::Column{table::Type::DECIMAL, false},
+                                 expression::Term::make_attribute(column_statistics_schema.table_name(), "min"));
+    column_statistics_schema.add(table::Column{table::Type::DECIMAL, false},
+                                 expression::Term::make_attribute(column_statistics_schema.table_name(), "max"));
+    column_statistics_schema.add(
+        table::Column{{table::Type::CHAR, 512}, false},
+        expression::Term::make_attribute(column_statistics_schema.table_name(), "most_common_values"));
+    column_statistics_schema.add(table::Column{{table::Type::CHAR, 512}, false},
+                                 expression::Term::make_attribute(column_statistics_schema.table_name(), "histogram"));
+    auto *column_statistics_table =
+        new table::Table(-1, SystemPageIds::ColumnStatistics, storage::Page::INVALID_PAGE_ID,
+                         std::move(column_statistics_schema));
+
     this->_tables[tables_table->name()] = tables_table;
     this->_tables[columns_table->name()] = columns_table;
     this->_tables[indices_table->name()] = indices_table;
     this->_tables[table_statistics_table->name()] = table_statistics_table;
+    this->_tables[column_statistics_table->name()] = column_statistics_table;
 }
 
 void Database::create_table(concurrency::Transaction *transaction, const table::Schema &schema)
@@ -317,9 +493,197 @@ void Database::create_index(concurrency::Transaction *transaction, const table::
         static_cast<storage::Page::offset_t>(indices_table->schema().row_size() + sizeof(concurrency::Metadata))});
 }
 
-void Database::persist_table_statistics(beedb::table::Table *table, std::uint64_t cardinality)
+void Database::persist_table_statistics(beedb::table::Table *table, std::uint64_t cardinality,
+                                        concurrency::Transaction *transaction)
+{
+    auto executor = io::Executor{*this, transaction};
+    const auto result = executor.execute(
+        {"update system_table_statistics set cardinality = " + std::to_string(std::int64_t(cardinality)) +
+         " where table_id = " + std::to_string(table->id()) + ";"});
+    if (result.error().empty() == false)
+    {
+        throw exception::ExecutionException{result.error()};
+    }
+}
+
+std::uint64_t Database::analyze(concurrency::Transaction *transaction, table::Table &table,
+                               const std::uint32_t sample_pages)
+{
+    const auto &schema = table.schema();
+
+    // Collect the pages of the table; pages are linked like a list.
+    std::vector<storage::Page::id_t> page_ids;
+    auto page_id = table.page_id();
+    while (page_id != storage::Page::INVALID_PAGE_ID)
+    {
+        page_ids.push_back(page_id);
+        auto *page = this->_buffer_manager.pin(page_id);
+        page_id = page->next_page_id();
+        this->_buffer_manager.unpin(page, false);
+    }
+
+    // Choose random pages to sample (partial Fisher-Yates shuffle) and
+    // read them in order of their ids.
+    const auto count_pages = page_ids.size();
+    if (sample_pages > 0u && sample_pages < count_pages)
+    {
+        auto random_generator = util::RandomGenerator{};
+        for (auto i = 0u; i < sample_pages; ++i)
+        {
+            const auto j = i + random_generator.next(count_pages - i);
+            std::swap(page_ids[i], page_ids[j]);
+        }
+        page_ids.resize(sample_pages);
+        std::sort(page_ids.begin(), page_ids.end());
+    }
+    const auto sampled_fraction = count_pages > 0u ? double(page_ids.size()) / double(count_pages) : 1.0;
+
+    std::vector<statistic::ColumnStatisticBuilder> builders;
+    builders.reserve(schema.size());
+    for (auto i = 0u; i < schema.size(); ++i)
+    {
+        builders.emplace_back(schema.column(i).type());
+    }
+
+    auto count_rows = std::uint64_t{0u};
+    for (const auto sample_page_id : page_ids)
+    {
+        auto *page = reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(sample_page_id));
+        auto [tuples, pinned_time_travel_pages] = this->_table_disk_manager.read_rows(page, transaction, schema);
+        for (const auto &tuple : tuples)
+        {
+            ++count_rows;
+            for (auto i = 0u; i < schema.size(); ++i)
+            {
+                builders[i].add(tuple.get(i));
+            }
+        }
+
+        for (const auto time_travel_page_id : pinned_time_travel_pages)
+        {
+            this->_buffer_manager.unpin(time_travel_page_id, false);
+        }
+        this->_buffer_manager.unpin(page, false);
+    }
+
+    const auto cardinality = static_cast<std::uint64_t>(std::llround(double(count_rows) / sampled_fraction));
+    this->persist_table_statistics(&table, cardinality, transaction);
+
+    auto column_statistics = std::vector<std::pair<std::int32_t, statistic::ColumnStatistic>>{};
+    column_statistics.reserve(schema.size());
+    for (auto i = 0u; i < schema.size(); ++i)
+    {
+        auto statistic = builders[i].build(Config::statistic_histogram_buckets, Config::statistic_most_common_values,
+                                           sampled_fraction);
+        this->persist_column_statistics(transaction, schema.column(i).id(), statistic);
+        column_statistics.emplace_back(schema.column(i).id(), std::move(statistic));
+    }
+
+    // The optimizer uses the statistics once they are persisted; they get lost when the transaction aborts.
+    transaction->on_commit([this, &table, cardinality, column_statistics = std::move(column_statistics)]() {
+        this->_statistics.table_statistics().cardinality(table, cardinality);
+        this->_statistics.table_statistics().reset_modifications(table);
+        for (const auto &[column_id, statistic] : column_statistics)
+        {
+            this->_statistics.column_statistics().statistic(column_id, statistic::ColumnStatistic{statistic});
+        }
+    });
+
+    return count_rows;
+}
+
+void Database::modified(table::Table &table, const std::uint64_t count_rows)
 {
-    auto executor = io::Executor{*this};
-    executor.execute({"update system_table_statistics set cardinality = " + std::to_string(std::int64_t(cardinality)) +
-                      " where table_id = " + std::to_string(table->id()) + ";"});
+    // System tables are modified by persisting statistics; analyzing them would schedule them again.
+    if (table.is_virtual())
+    {
+        return;
+    }
+
+    const auto count_modifications = this->_statistics.table_statistics().add_modifications(table, count_rows);
+
+    const auto threshold = static_cast<std::uint64_t>(this->_config[Config::k_AutoAnalyzeThreshold]);
+    if (threshold > 0u && count_modifications >= threshold)
+    {
+        {
+            std::unique_lock _{this->_auto_analyze_latch};
+            this->_auto_analyze_tables.insert(&table);
+        }
+        this->_auto_analyze_condition.notify_one();
+    }
+}
+
+void Database::auto_analyze()
+{
+    while (true)
+    {
+        table::Table *table = nullptr;
+        {
+            std::unique_lock lock{this->_auto_analyze_latch};
+            this->_auto_analyze_condition.wait(
+                lock, [this] { return this->_is_running == false || this->_auto_analyze_tables.empty() == false; });
+
+            if (this->_is_running == false)
+            {
+                return;
+            }
+
+            table = *this->_auto_analyze_tables.begin();
+            this->_auto_analyze_tables.erase(this->_auto_analyze_tables.begin());
+        }
+
+        // The table may be analyzed concurrently by other transactions; on conflicts, the
+        // commit fails and the table is analyzed again.
+        auto *transaction = this->_transaction_manager.new_transaction();
+        try
+        {
+            this->analyze(transaction, *table,
+                          static_cast<std::uint32_t>(this->_config[Config::k_AnalyzeSamplePages]));
+            if (this->_transaction_manager.commit(*transaction) == false)
+            {
+                std::unique_lock _{this->_auto_analyze_latch};
+                this->_auto_analyze_tables.insert(table);
+            }
+        }
+        catch (exception::DatabaseException &)
+        {
+            // The statistics stay outdated until the table is modified again.
+            this->_transaction_manager.abort(*transaction);
+        }
+        catch (std::runtime_error &)
+        {
+            this->_transaction_manager.abort(*transaction);
+        }
+        this->_transaction_manager.release(transaction);
+    }
+}
+
+void Database::persist_column_statistics(concurrency::Transaction *transaction, const std::int32_t column_id,
+                                         const statistic::ColumnStatistic &statistic)
+{
+    auto *column_statistics_table = this->_tables["system_column_statistics"];
+
+    auto executor = io::Executor{*this, transaction};
+    const auto result =
+        executor.execute({"delete from system_column_statistics where column_id = " + std::to_string(column_id) + ";"});
+    if (result.error().empty() == false)
+    {
+        throw exception::ExecutionException{result.error()};
+    }
+
+    auto tuple = table::Tuple{column_statistics_table->schema(), column_statistics_table->schema().row_size()};
+    tuple.set(0, column_id);
+    tuple.set(1, statistic.null_fraction());
+    tuple.set(2, std::int64_t(statistic.count_distinct()));
+    tuple.set(3, statistic.min());
+    tuple.set(4, statistic.max());
+    tuple.set(5, statistic.most_common_values_to_string());
+    tuple.set(6, statistic.histogram().to_string());
+
+    const auto record_identifier =
+        this->_table_disk_manager.add_row(transaction, *column_statistics_table, std::move(tuple));
+    transaction->add_to_write_set(concurrency::WriteSetItem{
+        column_statistics_table->id(), record_identifier,
+        static_cast<storage::Page::offset_t>(column_statistics_table->schema().row_size() +
+                                             sizeof(concurrency::Metadata))});
 }
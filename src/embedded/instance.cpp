@@ -0,0 +1,56 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <embedded/instance.h>
+
+using namespace beedb::embedded;
+
+Instance::Instance(const std::string &file_name, Config &&config)
+    : _config(std::move(config)), _database(_config, file_name)
+{
+    // Disable optimization during boot and re-enable it for user queries afterwards.
+    const auto is_optimization_disabled = static_cast<bool>(this->_config[Config::k_OptimizationDisableOptimization]);
+    this->_config.set(Config::k_OptimizationDisableOptimization, true);
+    this->_database.boot();
+    this->_config.set(Config::k_OptimizationDisableOptimization, is_optimization_disabled);
+}
+
+beedb::Config Instance::default_config()
+{
+    auto config = Config{};
+    config.set(Config::k_BufferFrames, 256, Config::ConfigMapValue::immutable);
+    config.set(Config::k_BufferReplacementStrategy, Config::Random, Config::ConfigMapValue::immutable);
+    config.set(Config::k_LRU_K, 2, Config::ConfigMapValue::immutable);
+    config.set(Config::k_ScanPageLimit, 64, Config::ConfigMapValue::immutable);
+    config.set(Config::k_OptimizationEnableIndexScan, false);
+    config.set(Config::k_OptimizationEnableHashJoin, false);
+    config.set(Config::k_OptimizationEnablePredicatePushDown, false);
+    config.set(Config::k_OptimizationDisableOptimization, false);
+    config.set(Config::k_CheckFinalPlan, false);
+    config.set(Config::k_PrintExecutionStatistics, false);
+    config.set(Config::k_StatementTimeout, 0);
+    config.set(Config::k_PerfCounters, false);
+    config.set(Config::k_AnalyzeSamplePages, 64);
+    config.set(Config::k_AutoAnalyzeThreshold, 0);
+    config.set(Config::k_CheckpointInterval, 60);
+    return config;
+}
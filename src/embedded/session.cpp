@@ -0,0 +1,112 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <concurrency/transaction_callback.h>
+#include <embedded/session.h>
+#include <exception/execution_exception.h>
+#include <io/executor.h>
+#include <optional>
+#include <vector>
+
+using namespace beedb::embedded;
+
+Session::~Session()
+{
+    if (this->_transaction != nullptr)
+    {
+        this->_database.transaction_manager().abort(*this->_transaction);
+        this->_database.transaction_manager().release(this->_transaction);
+    }
+}
+
+Result Session::execute(const std::string &statement)
+{
+    auto result = Result{};
+    auto execution_callback = io::FunctionalExecutionCallback{
+        [&result](const table::Schema &schema) { result.schema(schema); },
+        [&result](const table::Tuple &tuple) {
+            if (tuple.has_data())
+            {
+                result.push_back(tuple.data(), tuple.schema().row_size());
+            }
+        }};
+
+    result.execution_time(this->run(statement, execution_callback));
+    return result;
+}
+
+std::uint64_t Session::execute(const std::string &statement,
+                               const std::function<void(const RowBatch &)> &batch_callback,
+                               const std::size_t batch_size)
+{
+    auto schema = std::optional<table::Schema>{};
+    auto rows = std::vector<std::byte>{};
+    auto count_batch_rows = 0u;
+    auto count_rows = std::uint64_t{0u};
+
+    auto execution_callback = io::FunctionalExecutionCallback{
+        [&schema, &rows, batch_size](const table::Schema &result_schema) {
+            schema.emplace(result_schema);
+            rows.reserve(batch_size * result_schema.row_size());
+        },
+        [&](const table::Tuple &tuple) {
+            if (tuple.has_data() == false)
+            {
+                return;
+            }
+
+            rows.insert(rows.end(), tuple.data(), tuple.data() + schema->row_size());
+            ++count_rows;
+            if (++count_batch_rows == batch_size)
+            {
+                batch_callback(RowBatch{schema.value(), rows.data(), count_batch_rows});
+                rows.clear();
+                count_batch_rows = 0u;
+            }
+        }};
+
+    this->run(statement, execution_callback);
+
+    if (count_batch_rows > 0u)
+    {
+        batch_callback(RowBatch{schema.value(), rows.data(), count_batch_rows});
+    }
+
+    return count_rows;
+}
+
+std::chrono::milliseconds Session::run(const std::string &statement, io::ExecutionCallback &execution_callback)
+{
+    auto transaction_callback = concurrency::FunctionTransactionCallback{
+        [this](concurrency::Transaction *transaction) { this->_transaction = transaction; },
+        [this](concurrency::Transaction *, const bool) { this->_transaction = nullptr; }};
+
+    this->_cancellation.reset();
+    auto executor = io::Executor{this->_database, this->_transaction, &this->_cancellation};
+    const auto result = executor.execute(io::Query{statement}, execution_callback, transaction_callback);
+    if (result.is_successful() == false)
+    {
+        throw exception::ExecutionException(result.error());
+    }
+
+    return result.build_time() + result.execution_time();
+}
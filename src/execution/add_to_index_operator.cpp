@@ -50,15 +50,30 @@ beedb::util::optional<beedb::table::Tuple> AddToIndexOperator::next()
             const auto &column = next->schema().column(this->_column_index);
             if (column == table::Type::INT)
             {
-                this->_index->put(std::get<std::int32_t>(next->get(this->_column_index).value()), next->page_id());
+                this->put(std::get<std::int32_t>(next->get(this->_column_index).value()), next->page_id());
             }
             else if (column == table::Type::LONG)
             {
-                this->_index->put(std::get<std::int64_t>(next->get(this->_column_index).value()), next->page_id());
+                this->put(std::get<std::int64_t>(next->get(this->_column_index).value()), next->page_id());
             }
         }
         return next;
     }
 
     return {};
+}
+
+void AddToIndexOperator::put(const std::int64_t key, const beedb::storage::Page::id_t page_id)
+{
+    if (this->_index->contains(key, page_id))
+    {
+        return;
+    }
+
+    this->_index->put(key, page_id);
+    if (this->transaction() != nullptr)
+    {
+        this->transaction()->add_to_index_write_set(
+            concurrency::IndexWriteSetItem{this->_index, key, page_id, concurrency::IndexWriteSetItem::Inserted});
+    }
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <execution/analyze_operator.h>
+
+using namespace beedb::execution;
+
+AnalyzeOperator::AnalyzeOperator(Database &database, concurrency::Transaction *transaction,
+                                 std::vector<table::Table *> &&tables, const std::uint32_t sample_pages)
+    : OperatorInterface(transaction), _database(database), _tables(std::move(tables)), _sample_pages(sample_pages)
+{
+}
+
+beedb::util::optional<beedb::table::Tuple> AnalyzeOperator::next()
+{
+    for (auto *table : this->_tables)
+    {
+        this->_database.analyze(this->transaction(), *table, this->_sample_pages);
+    }
+
+    this->_tables.clear();
+
+    return {};
+}
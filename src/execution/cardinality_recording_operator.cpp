@@ -0,0 +1,59 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <execution/cardinality_recording_operator.h>
+
+using namespace beedb::execution;
+
+CardinalityRecordingOperator::CardinalityRecordingOperator(beedb::concurrency::Transaction *transaction,
+                                                           std::unique_ptr<OperatorInterface> &&child,
+                                                           std::optional<std::uint64_t> &cardinality)
+    : UnaryOperator(transaction), _cardinality(cardinality)
+{
+    this->child(std::move(child));
+}
+
+void CardinalityRecordingOperator::open()
+{
+    this->_count = 0u;
+    this->child()->open();
+}
+
+void CardinalityRecordingOperator::close()
+{
+    this->child()->close();
+}
+
+beedb::util::optional<beedb::table::Tuple> CardinalityRecordingOperator::next()
+{
+    auto tuple = this->child()->next();
+    if (tuple == true)
+    {
+        ++this->_count;
+    }
+    else
+    {
+        this->_cardinality = this->_count;
+    }
+
+    return tuple;
+}
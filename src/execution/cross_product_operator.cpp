@@ -58,6 +58,7 @@ beedb::util::optional<beedb::table::Tuple> CrossProductOperator::next()
             return util::optional{this->combine(this->_schema, this->_next_left_tuple, next_right_tuple)};
         }
         this->right_child()->close();
+        this->check_cancellation();
         this->right_child()->open();
         this->_next_left_tuple = this->left_child()->next();
     }
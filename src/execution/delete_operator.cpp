@@ -57,10 +57,12 @@ beedb::util::optional<beedb::table::Tuple> DeleteOperator::next()
             throw exception::AbortTransactionException();
         }
 
-        this->transaction()->add_to_write_set(concurrency::WriteSetItem{
+        auto write_set_item = concurrency::WriteSetItem{
             this->_table.id(), next->record_identifier(), storage::RecordIdentifier{},
             concurrency::WriteSetItem::Deleted,
-            static_cast<storage::Page::offset_t>(next->schema().row_size() + sizeof(concurrency::Metadata))});
+            static_cast<storage::Page::offset_t>(next->schema().row_size() + sizeof(concurrency::Metadata))};
+        this->_table_disk_manager.log_modification(this->transaction(), write_set_item);
+        this->transaction()->add_to_write_set(std::move(write_set_item));
 
         next = this->child()->next();
     }
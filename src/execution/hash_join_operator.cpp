@@ -130,6 +130,7 @@ beedb::util::optional<beedb::table::Tuple> HashJoinOperator::next()
     // Build phase
     if (this->_is_built == false)
     {
+        this->check_cancellation();
         this->build_hash_table();
         this->_is_built = true;
     }
@@ -145,5 +146,6 @@ beedb::util::optional<beedb::table::Tuple> HashJoinOperator::next()
     }
 
     // Probe phase
+    this->check_cancellation();
     return this->probe_hash_table();
 }
@@ -0,0 +1,105 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <algorithm>
+#include <execution/index_lookup.h>
+#include <index/non_unique_index_interface.h>
+#include <index/range_index_interface.h>
+#include <index/unique_index_interface.h>
+#include <iterator>
+
+using namespace beedb::execution;
+
+std::vector<beedb::storage::Page::id_t> IndexLookup::pages() const
+{
+    if (this->_type == Type::Probe)
+    {
+        return this->probe();
+    }
+
+    auto left_pages = this->_left->pages();
+    if (this->_type == Type::Intersection && left_pages.empty())
+    {
+        return left_pages;
+    }
+
+    const auto right_pages = this->_right->pages();
+
+    std::vector<storage::Page::id_t> pages;
+    if (this->_type == Type::Intersection)
+    {
+        pages.reserve(std::min(left_pages.size(), right_pages.size()));
+        std::set_intersection(left_pages.cbegin(), left_pages.cend(), right_pages.cbegin(), right_pages.cend(),
+                              std::back_inserter(pages));
+    }
+    else
+    {
+        pages.reserve(left_pages.size() + right_pages.size());
+        std::set_union(left_pages.cbegin(), left_pages.cend(), right_pages.cbegin(), right_pages.cend(),
+                       std::back_inserter(pages));
+    }
+
+    return pages;
+}
+
+std::vector<beedb::storage::Page::id_t> IndexLookup::probe() const
+{
+    std::vector<storage::Page::id_t> pages;
+    for (const auto &key_range : this->_key_ranges)
+    {
+        if (key_range.is_single_key())
+        {
+            if (this->_index->is_unique())
+            {
+                const auto key_pages =
+                    dynamic_cast<index::UniqueIndexInterface *>(this->_index.get())->get(key_range.single_key());
+                if (key_pages.has_value())
+                {
+                    pages.insert(pages.end(), key_pages->begin(), key_pages->end());
+                }
+            }
+            else
+            {
+                const auto key_pages =
+                    dynamic_cast<index::NonUniqueIndexInterface *>(this->_index.get())->get(key_range.single_key());
+                if (key_pages.has_value())
+                {
+                    pages.insert(pages.end(), key_pages->begin(), key_pages->end());
+                }
+            }
+        }
+        else
+        {
+            const auto key_pages =
+                dynamic_cast<index::RangeIndexInterface *>(this->_index.get())->get(key_range.from(), key_range.to());
+            if (key_pages.has_value())
+            {
+                pages.insert(pages.end(), key_pages->begin(), key_pages->end());
+            }
+        }
+    }
+
+    // Pages are fetched in order and only once, even if multiple keys are found on the same page.
+    std::sort(pages.begin(), pages.end());
+    pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+    return pages;
+}
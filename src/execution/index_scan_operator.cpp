@@ -20,10 +20,10 @@
  *------------------------------------------------------------------------------*
  */
 
+#include <algorithm>
 #include <execution/index_scan_operator.h>
-#include <index/non_unique_index_interface.h>
 #include <index/range_index_interface.h>
-#include <index/unique_index_interface.h>
+#include <limits>
 
 using namespace beedb::execution;
 
@@ -32,52 +32,43 @@ IndexScanOperator::IndexScanOperator(beedb::concurrency::Transaction *transactio
                                      beedb::table::TableDiskManager &table_disk_manager,
                                      std::unordered_set<KeyRange> &&key_ranges,
                                      std::shared_ptr<index::IndexInterface> index)
+    : IndexScanOperator(transaction, scan_page_limit, schema, buffer_manager, table_disk_manager,
+                        std::make_unique<IndexLookup>(std::move(index), std::move(key_ranges)))
+{
+}
+
+IndexScanOperator::IndexScanOperator(beedb::concurrency::Transaction *transaction, const std::uint32_t scan_page_limit,
+                                     const beedb::table::Schema &schema, beedb::buffer::Manager &buffer_manager,
+                                     beedb::table::TableDiskManager &table_disk_manager,
+                                     std::unique_ptr<IndexLookup> &&lookup)
     : OperatorInterface(transaction), _scan_page_limit(scan_page_limit), _schema(schema),
-      _buffer_manager(buffer_manager), _table_disk_manager(table_disk_manager), _key_ranges(std::move(key_ranges)),
-      _index(index)
+      _buffer_manager(buffer_manager), _table_disk_manager(table_disk_manager), _lookup(std::move(lookup))
+{
+}
+
+IndexScanOperator::IndexScanOperator(beedb::concurrency::Transaction *transaction, const beedb::table::Schema &schema,
+                                     beedb::buffer::Manager &buffer_manager,
+                                     beedb::table::TableDiskManager &table_disk_manager,
+                                     std::shared_ptr<index::IndexInterface> index,
+                                     const beedb::table::Schema::ColumnIndexType key_column_index,
+                                     const KeyRange &key_range)
+    : OperatorInterface(transaction), _scan_page_limit(0u), _schema(schema), _buffer_manager(buffer_manager),
+      _table_disk_manager(table_disk_manager), _is_ordered(true), _ordered_index(std::move(index)),
+      _key_column_index(key_column_index), _next_key(key_range.from()), _last_key(key_range.to()),
+      _is_exhausted(key_range.from() > key_range.to())
 {
 }
 
 void IndexScanOperator::open()
 {
-    for (const auto &key_range : this->_key_ranges)
+    if (this->_is_ordered)
     {
-        if (key_range.is_single_key())
-        {
-            if (this->_index->is_unique())
-            {
-                const auto page =
-                    dynamic_cast<index::UniqueIndexInterface *>(this->_index.get())->get(key_range.single_key());
-                if (page.has_value())
-                {
-                    this->_pages_to_scan.push(page.value());
-                }
-            }
-            else
-            {
-                const auto pages =
-                    dynamic_cast<index::NonUniqueIndexInterface *>(this->_index.get())->get(key_range.single_key());
-                if (pages.has_value())
-                {
-                    for (const auto page : pages.value())
-                    {
-                        this->_pages_to_scan.push(page);
-                    }
-                }
-            }
-        }
-        else
-        {
-            const auto pages =
-                dynamic_cast<index::RangeIndexInterface *>(this->_index.get())->get(key_range.from(), key_range.to());
-            if (pages.has_value())
-            {
-                for (const auto page : pages.value())
-                {
-                    this->_pages_to_scan.push(page);
-                }
-            }
-        }
+        return;
+    }
+
+    for (const auto page_id : this->_lookup->pages())
+    {
+        this->_pages_to_scan.push(page_id);
     }
 }
 
@@ -98,8 +89,11 @@ beedb::util::optional<beedb::table::Tuple> IndexScanOperator::next()
     if (this->_buffer.empty() == false)
     {
         auto next = this->_buffer.pop();
-        this->transaction()->add_to_read_set(
-            concurrency::ReadSetItem({next.metadata()->original_record_identifier(), next.record_identifier()}));
+        if (this->transaction()->is_validating_reads())
+        {
+            this->transaction()->add_to_read_set(
+                concurrency::ReadSetItem({next.metadata()->original_record_identifier(), next.record_identifier()}));
+        }
         return util::optional{std::move(next)};
     }
 
@@ -114,21 +108,44 @@ beedb::util::optional<beedb::table::Tuple> IndexScanOperator::next()
         this->_pinned_pages.clear();
     }
 
-    if (this->_pages_to_scan.empty())
+    if (this->_is_ordered)
     {
-        return {};
+        this->read_ordered();
+    }
+    else
+    {
+        this->read_pages();
     }
 
-    // When we need more, scan pages max pages.
-    for (auto i = 0u; i < this->_scan_page_limit; i++)
+    if (this->_buffer.empty() == false)
     {
-        if (this->_pages_to_scan.empty())
+        auto next = this->_buffer.pop();
+        if (this->transaction()->is_validating_reads())
         {
-            break;
+            this->transaction()->add_to_read_set(
+                concurrency::ReadSetItem({next.metadata()->original_record_identifier(), next.record_identifier()}));
         }
+        return util::optional{std::move(next)};
+    }
+    else
+    {
+        return {};
+    }
+}
 
+void IndexScanOperator::read_pages()
+{
+    // When we need more, scan pages max pages. Pages without visible
+    // rows are skipped, until rows are found or all pages are scanned.
+    auto count_scanned_pages = 0u;
+    while (this->_pages_to_scan.empty() == false &&
+           (count_scanned_pages < this->_scan_page_limit || this->_buffer.empty()))
+    {
+        this->check_cancellation();
         auto next_page_id = this->_pages_to_scan.front();
         this->_pages_to_scan.pop();
+        ++count_scanned_pages;
+
         auto page = reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(next_page_id));
         auto [tuples, pinned_time_travel_pages] =
             this->_table_disk_manager.read_rows(page, this->transaction(), this->_schema);
@@ -143,19 +160,93 @@ beedb::util::optional<beedb::table::Tuple> IndexScanOperator::next()
         else
         {
             this->_buffer_manager.unpin(page, false);
-            break;
         }
     }
+}
 
-    if (this->_buffer.empty() == false)
+void IndexScanOperator::read_ordered()
+{
+    auto *range_index = dynamic_cast<index::RangeIndexInterface *>(this->_ordered_index.get());
+    while (this->_buffer.empty() && this->_is_exhausted == false)
     {
-        auto next = this->_buffer.pop();
-        this->transaction()->add_to_read_set(
-            concurrency::ReadSetItem({next.metadata()->original_record_identifier(), next.record_identifier()}));
-        return util::optional{std::move(next)};
+        this->check_cancellation();
+        const auto entries =
+            range_index->get_ordered(this->_next_key, this->_last_key, IndexScanOperator::ordered_batch_keys);
+        if (entries.empty())
+        {
+            this->_is_exhausted = true;
+            break;
+        }
+
+        const auto first_key = entries.front().first;
+        const auto last_key = entries.back().first;
+        if (last_key >= this->_last_key || last_key == std::numeric_limits<std::int64_t>::max())
+        {
+            this->_is_exhausted = true;
+        }
+        else
+        {
+            this->_next_key = last_key + 1;
+        }
+
+        // Every page is read once per batch, even if it holds multiple keys of the batch.
+        std::vector<storage::Page::id_t> pages;
+        pages.reserve(entries.size());
+        std::transform(entries.cbegin(), entries.cend(), std::back_inserter(pages),
+                       [](const auto &entry) { return entry.second; });
+        std::sort(pages.begin(), pages.end());
+        pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+        std::vector<table::Tuple> batch;
+        std::vector<std::pair<std::int64_t, std::size_t>> batch_keys;
+        for (const auto page_id : pages)
+        {
+            auto page = reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(page_id));
+            auto [tuples, pinned_time_travel_pages] =
+                this->_table_disk_manager.read_rows(page, this->transaction(), this->_schema);
+            this->_pinned_pages.insert(this->_pinned_pages.end(), pinned_time_travel_pages.begin(),
+                                       pinned_time_travel_pages.end());
+
+            const auto count_rows = batch.size();
+            for (auto &tuple : tuples)
+            {
+                const auto key = this->key(tuple);
+                if (key >= first_key && key <= last_key)
+                {
+                    batch_keys.emplace_back(key, batch.size());
+                    batch.emplace_back(std::move(tuple));
+                }
+            }
+
+            if (batch.size() > count_rows)
+            {
+                this->_pinned_pages.push_back(page->id());
+            }
+            else
+            {
+                this->_buffer_manager.unpin(page, false);
+            }
+        }
+
+        // Tuples can not be move-assigned; sort their positions instead.
+        std::sort(batch_keys.begin(), batch_keys.end());
+        std::vector<table::Tuple> ordered_batch;
+        ordered_batch.reserve(batch.size());
+        for (const auto &[_, position] : batch_keys)
+        {
+            ordered_batch.emplace_back(std::move(batch[position]));
+        }
+        this->_buffer.add(std::move(ordered_batch));
     }
-    else
+}
+
+std::int64_t IndexScanOperator::key(const table::Tuple &tuple) const
+{
+    const auto value = tuple.get(this->_key_column_index);
+    if (this->_schema.column(this->_key_column_index) == table::Type::INT)
     {
-        return {};
+        return value.get<std::int32_t>();
     }
+
+    return value.get<std::int64_t>();
 }
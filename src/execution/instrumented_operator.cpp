@@ -0,0 +1,87 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <algorithm>
+#include <execution/instrumented_operator.h>
+
+using namespace beedb::execution;
+
+InstrumentedOperator::InstrumentedOperator(beedb::concurrency::Transaction *transaction,
+                                           std::unique_ptr<OperatorInterface> &&child, OperatorStatistics &statistics)
+    : UnaryOperator(transaction), _statistics(statistics)
+{
+    this->child(std::move(child));
+
+    if (statistics.perf != nullptr)
+    {
+        for (const auto &counter : statistics.perf->counter())
+        {
+            statistics.performance_counters.emplace_back(counter.name(), 0.0);
+        }
+    }
+}
+
+void InstrumentedOperator::open()
+{
+    const auto start = this->sample();
+    this->child()->open();
+    this->record(start);
+}
+
+void InstrumentedOperator::close()
+{
+    const auto start = this->sample();
+    this->child()->close();
+    this->record(start);
+}
+
+beedb::util::optional<beedb::table::Tuple> InstrumentedOperator::next()
+{
+    const auto start = this->sample();
+    auto tuple = this->child()->next();
+    this->record(start);
+
+    ++this->_statistics.count_next_calls;
+    if (tuple == true)
+    {
+        ++this->_statistics.count_rows;
+    }
+
+    return tuple;
+}
+
+void InstrumentedOperator::record(const Sample &start)
+{
+    const auto end = this->sample();
+    this->_statistics.time += end.time - start.time;
+    this->_statistics.count_pinned_pages += end.access_statistics.count_pins - start.access_statistics.count_pins;
+    this->_statistics.count_buffer_hits += end.access_statistics.count_hits - start.access_statistics.count_hits;
+    this->_statistics.count_buffer_misses +=
+        end.access_statistics.count_misses - start.access_statistics.count_misses;
+    this->_statistics.peak_memory = std::max(this->_statistics.peak_memory, this->child()->memory_usage());
+
+    for (auto i = 0u; i < end.performance_counters.size(); ++i)
+    {
+        this->_statistics.performance_counters[i].second +=
+            util::PerfCounter::difference(start.performance_counters[i], end.performance_counters[i]);
+    }
+}
@@ -49,6 +49,7 @@ beedb::util::optional<beedb::table::Tuple> OrderOperator::next()
         auto tuple = this->child()->next();
         while (tuple == true)
         {
+            this->check_cancellation();
             this->_result_table->add(tuple);
             tuple = this->child()->next();
         }
@@ -58,6 +59,7 @@ beedb::util::optional<beedb::table::Tuple> OrderOperator::next()
             return {};
         }
 
+        this->check_cancellation();
         auto comparator = TupleComparator{this->_order_columns};
         util::Quicksort::sort(this->_result_table->tuples(), comparator);
     }
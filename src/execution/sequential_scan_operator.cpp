@@ -56,8 +56,11 @@ beedb::util::optional<beedb::table::Tuple> SequentialScanOperator::next()
     if (this->_buffer.empty() == false)
     {
         auto next = this->_buffer.pop();
-        this->transaction()->add_to_read_set(
-            concurrency::ReadSetItem({next.metadata()->original_record_identifier(), next.record_identifier()}));
+        if (this->transaction()->is_validating_reads())
+        {
+            this->transaction()->add_to_read_set(
+                concurrency::ReadSetItem({next.metadata()->original_record_identifier(), next.record_identifier()}));
+        }
         return util::optional{std::move(next)};
     }
 
@@ -85,6 +88,7 @@ beedb::util::optional<beedb::table::Tuple> SequentialScanOperator::next()
             break;
         }
 
+        this->check_cancellation();
         auto page = reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(this->_next_page_id_to_scan));
         auto [tuples, pinned_time_travel_pages] =
             this->_table_disk_manager.read_rows(page, this->transaction(), this->_schema);
@@ -109,8 +113,11 @@ beedb::util::optional<beedb::table::Tuple> SequentialScanOperator::next()
     if (this->_buffer.empty() == false)
     {
         auto next = this->_buffer.pop();
-        this->transaction()->add_to_read_set(
-            concurrency::ReadSetItem({next.metadata()->original_record_identifier(), next.record_identifier()}));
+        if (this->transaction()->is_validating_reads())
+        {
+            this->transaction()->add_to_read_set(
+                concurrency::ReadSetItem({next.metadata()->original_record_identifier(), next.record_identifier()}));
+        }
         return util::optional{std::move(next)};
     }
     else
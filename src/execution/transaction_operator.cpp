@@ -31,7 +31,7 @@ void BeginTransactionOperator::open()
 
 beedb::util::optional<beedb::table::Tuple> BeginTransactionOperator::next()
 {
-    auto *transaction = this->_transaction_manager.new_transaction();
+    auto *transaction = this->_transaction_manager.new_transaction(this->_isolation_level, this->_is_read_only);
     this->_transaction_callback.on_begin(transaction);
     return {};
 }
@@ -21,7 +21,9 @@
  */
 
 #include <exception/concurrency_exception.h>
+#include <exception/exception.h>
 #include <execution/update_operator.h>
+#include <storage/record_page.h>
 
 using namespace beedb::execution;
 
@@ -65,15 +67,156 @@ beedb::util::optional<beedb::table::Tuple> UpdateOperator::next()
 
         for (const auto &update : this->_new_column_values)
         {
+            const auto old_key = UpdateOperator::index_key(next.value(), update.first);
             next->set(update.first, update.second);
+            this->update_indices(next.value(), update.first, old_key);
         }
 
-        this->transaction()->add_to_write_set(concurrency::WriteSetItem{
+        auto write_set_item = concurrency::WriteSetItem{
             this->_table.id(), next->record_identifier(), copied_rid, concurrency::WriteSetItem::Updated,
-            static_cast<storage::Page::offset_t>(next->schema().row_size() + sizeof(concurrency::Metadata))});
+            static_cast<storage::Page::offset_t>(next->schema().row_size() + sizeof(concurrency::Metadata))};
+        this->_table_disk_manager.log_modification(this->transaction(), write_set_item);
+        this->transaction()->add_to_write_set(std::move(write_set_item));
 
         next = this->child()->next();
     }
 
     return {};
-}
\ No newline at end of file
+}
+
+std::optional<std::int64_t> UpdateOperator::index_key(const beedb::table::Tuple &tuple,
+                                                      const beedb::table::Schema::ColumnIndexType column_index)
+{
+    const auto &column = tuple.schema().column(column_index);
+    if (column == table::Type::INT)
+    {
+        return tuple.get(column_index).get<std::int32_t>();
+    }
+
+    if (column == table::Type::LONG)
+    {
+        return tuple.get(column_index).get<std::int64_t>();
+    }
+
+    return std::nullopt;
+}
+
+void UpdateOperator::update_indices(const beedb::table::Tuple &tuple,
+                                    const beedb::table::Schema::ColumnIndexType column_index,
+                                    const std::optional<std::int64_t> old_key)
+{
+    const auto &column = tuple.schema().column(column_index);
+    const auto new_key = UpdateOperator::index_key(tuple, column_index);
+    if (column.is_indexed() == false || tuple.page_id() == storage::Page::INVALID_PAGE_ID ||
+        old_key.has_value() == false || old_key == new_key)
+    {
+        return;
+    }
+
+    for (const auto &index : column.indices())
+    {
+        if (index->contains(new_key.value(), tuple.page_id()) == false)
+        {
+            index->put(new_key.value(), tuple.page_id());
+            this->transaction()->add_to_index_write_set(concurrency::IndexWriteSetItem{
+                index, new_key.value(), tuple.page_id(), concurrency::IndexWriteSetItem::Inserted});
+        }
+
+        // Transactions reading older snapshots find the replaced version by the old key;
+        // the entry is removed once no transaction can see that version anymore.
+        this->transaction()->on_reclaim(
+            [&buffer_manager = this->_buffer_manager, &schema = this->_table.schema(), index, column_index,
+             key = old_key.value(), page_id = tuple.page_id()](const concurrency::timestamp::timestamp_t oldest_time) {
+                UpdateOperator::remove_replaced_key(buffer_manager, schema, *index, column_index, key, page_id,
+                                                    oldest_time);
+            });
+    }
+}
+
+void UpdateOperator::remove_replaced_key(buffer::Manager &buffer_manager, const table::Schema &schema,
+                                         index::IndexInterface &index,
+                                         const beedb::table::Schema::ColumnIndexType column_index,
+                                         const std::int64_t key, const storage::Page::id_t page_id,
+                                         const concurrency::timestamp::timestamp_t oldest_active_time)
+{
+    // Removing is best effort, a kept entry only costs reading the page.
+    try
+    {
+        if (UpdateOperator::is_key_on_page(buffer_manager, schema, column_index, key, page_id, oldest_active_time))
+        {
+            return;
+        }
+
+        index.remove(key, page_id);
+
+        // A record written meanwhile may have found the entry before it was removed.
+        if (UpdateOperator::is_key_on_page(buffer_manager, schema, column_index, key, page_id, oldest_active_time))
+        {
+            index.put(key, page_id);
+        }
+    }
+    catch (exception::DatabaseException &)
+    {
+    }
+}
+
+bool UpdateOperator::is_key_on_page(buffer::Manager &buffer_manager, const table::Schema &schema,
+                                    const beedb::table::Schema::ColumnIndexType column_index, const std::int64_t key,
+                                    const storage::Page::id_t page_id,
+                                    const concurrency::timestamp::timestamp_t oldest_active_time)
+{
+    // Versions ended before the oldest running transaction began are not visible to any transaction;
+    // the versions in a chain are ordered newest first, so all following versions are invisible, too.
+    const auto is_visible = [oldest_active_time](const concurrency::Metadata *metadata) {
+        const auto end = metadata->end_timestamp();
+        return end.is_committed() == false || end.is_infinity() || end.time() > oldest_active_time;
+    };
+    const auto holds_key = [&schema, column_index, key](const storage::RecordIdentifier record_identifier,
+                                                        std::byte *record) {
+        const auto tuple = table::Tuple{schema, record_identifier, reinterpret_cast<concurrency::Metadata *>(record),
+                                        record + sizeof(concurrency::Metadata)};
+        return UpdateOperator::index_key(tuple, column_index) == key;
+    };
+
+    auto *page = reinterpret_cast<storage::RecordPage *>(buffer_manager.pin(page_id));
+    auto is_key_on_page = false;
+    for (auto slot_id = 0u; slot_id < page->slots() && is_key_on_page == false; ++slot_id)
+    {
+        if (page->is_free(slot_id))
+        {
+            continue;
+        }
+
+        auto *record = page->record(slot_id);
+        const auto *metadata = reinterpret_cast<concurrency::Metadata *>(record);
+        if (is_visible(metadata) == false)
+        {
+            continue;
+        }
+        is_key_on_page = holds_key({page_id, static_cast<std::uint16_t>(slot_id)}, record);
+
+        auto version_identifier = metadata->next_in_version_chain();
+        while (is_key_on_page == false && static_cast<bool>(version_identifier))
+        {
+            auto *time_travel_page =
+                reinterpret_cast<storage::RecordPage *>(buffer_manager.pin(version_identifier.page_id()));
+            auto next_version_identifier = storage::RecordIdentifier{};
+            if (version_identifier.slot() < time_travel_page->slots() &&
+                time_travel_page->is_free(version_identifier.slot()) == false)
+            {
+                auto *version = time_travel_page->record(version_identifier.slot());
+                const auto *version_metadata = reinterpret_cast<concurrency::Metadata *>(version);
+                if (is_visible(version_metadata))
+                {
+                    is_key_on_page = holds_key(version_identifier, version);
+                    next_version_identifier = version_metadata->next_in_version_chain();
+                }
+            }
+            buffer_manager.unpin(time_travel_page, false);
+            version_identifier = next_version_identifier;
+        }
+    }
+    buffer_manager.unpin(page, false);
+
+    return is_key_on_page;
+}
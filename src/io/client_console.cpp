@@ -20,12 +20,19 @@
  *------------------------------------------------------------------------------*
  */
 
+#include <atomic>
+#include <csignal>
+#include <iomanip>
 #include <io/client_console.h>
+#include <io/columnar_result_serializer.h>
+#include <io/query_result_serializer.h>
 #include <io/result_output_formatter.h>
 #include <io/server_response.h>
 #include <iostream>
 #include <nlohmann/json.hpp>
 #include <regex>
+#include <sstream>
+#include <util/block_compressor.h>
 #include <util/command_line_interface.h>
 
 using namespace beedb::io;
@@ -36,7 +43,27 @@ constexpr static auto BEEDB_PROMPT = "beedb (DEBUG)> ";
 constexpr static auto BEEDB_PROMPT = "beedb> ";
 #endif
 
-ClientConsole::ClientConsole(std::string &&server, const std::uint16_t port) : _client(std::move(server), port)
+// Client waiting for the response to a query; Ctrl-C cancels the query.
+static std::atomic<const beedb::network::Client *> waiting_client{nullptr};
+
+static void cancel_query(const int signal)
+{
+    const auto *client = waiting_client.load();
+    if (client != nullptr)
+    {
+        client->cancel();
+    }
+    else
+    {
+        std::signal(signal, SIG_DFL);
+        std::raise(signal);
+    }
+}
+
+ClientConsole::ClientConsole(std::string &&server, const std::uint16_t port, std::string &&result_format,
+                             const util::StreamingTextTable::Format output_format)
+    : _client(std::move(server), port), _result_format(std::move(result_format)),
+      _result_formatter(std::cout, output_format)
 {
 }
 
@@ -53,6 +80,22 @@ void ClientConsole::run()
         return;
     }
 
+    // Rows are the default format of the server.
+    if (this->_result_format != "rows")
+    {
+        if (this->handle_response(this->_client.send(":format " + this->_result_format)) == false)
+        {
+            return;
+        }
+    }
+
+    struct sigaction cancel_action
+    {
+    };
+    cancel_action.sa_handler = cancel_query;
+    cancel_action.sa_flags = SA_RESTART;
+    sigaction(SIGINT, &cancel_action, nullptr);
+
     const auto quit_regex = std::regex("q|quit|:q|:quit|e|exit|:e|:exit", std::regex_constants::icase);
     std::cout << "Type 'q' or 'quit' to exit." << std::endl;
 
@@ -70,8 +113,17 @@ void ClientConsole::run()
         }
         else
         {
-            const auto response = this->_client.send(user_input.value());
-            if (ClientConsole::handle_response(response) == false)
+            waiting_client = &this->_client;
+            auto is_connected = this->handle_response(this->_client.send(user_input.value()));
+
+            // Results are streamed in chunks, until the server closes the result.
+            while (is_connected && this->_result_schema.has_value())
+            {
+                is_connected = this->handle_response(this->_client.receive());
+            }
+            waiting_client = nullptr;
+
+            if (is_connected == false)
             {
                 return;
             }
@@ -83,19 +135,74 @@ void ClientConsole::run()
 
 bool ClientConsole::handle_response(const std::string &response)
 {
+    if (response.size() < sizeof(ServerResponse))
+    {
+        std::cerr << "Lost connection to BeeDB server." << std::endl;
+        return false;
+    }
+
     const auto *server_response = reinterpret_cast<const ServerResponse *>(response.data());
     if (server_response->type() == ServerResponse::Type::Error)
     {
+        // The error may abort a streamed result.
+        this->_result_schema.reset();
+        this->_result_formatter.clear();
+
         const auto *error = reinterpret_cast<const ErrorResponse *>(server_response);
         std::cerr << "\033[0;31merror\033[0m> " << error->message() << std::endl;
     }
+    else if (server_response->type() == ServerResponse::Type::ResultSchema)
+    {
+        const auto *schema = reinterpret_cast<const ResultSchemaResponse *>(server_response);
+        this->_result_schema = QueryResultSerializer::deserialize(schema->data());
+        this->_result_formatter.header(this->_result_schema.value());
+    }
+    else if (server_response->type() == ServerResponse::Type::ResultRows)
+    {
+        const auto *rows = reinterpret_cast<const ResultRowsResponse *>(server_response);
+        this->_result_formatter.push_back(this->_result_schema.value(), rows->count_rows(), rows->data());
+    }
+    else if (server_response->type() == ServerResponse::Type::ResultColumns)
+    {
+        const auto *columns = reinterpret_cast<const ResultColumnsResponse *>(server_response);
+        const auto *data = columns->data();
+        if (columns->is_compressed())
+        {
+            this->_result_columns.clear();
+            util::BlockCompressor::decompress(data, response.size() - sizeof(ResultColumnsResponse),
+                                              columns->uncompressed_size(), this->_result_columns);
+            data = this->_result_columns.data();
+        }
+
+        this->_result_rows.clear();
+        ColumnarResultSerializer::deserialize(this->_result_schema.value(), data, columns->count_rows(),
+                                              this->_result_rows);
+        this->_result_formatter.push_back(this->_result_schema.value(), columns->count_rows(),
+                                          this->_result_rows.data());
+    }
     else if (server_response->type() == ServerResponse::Type::AnalyticalResult)
     {
         const auto *records = reinterpret_cast<const AnalyticalResponse *>(server_response);
-        const auto formatter = ResultOutputFormatter::from_serialized_data(records->count_rows(), records->data());
-        std::cout << formatter << "Fetched \033[1;32m" << records->count_rows() << "\033[0m row"
-                  << (records->count_rows() == 1U ? "" : "s") << " in \033[1;33m" << records->execution_time_in_ms()
-                  << "\033[0m ms." << std::endl;
+        this->_result_formatter.flush();
+
+        // Keep CSV and TSV output free from statistics, e.g., for piping.
+        auto &statistics_stream =
+            this->_result_formatter.format() == util::StreamingTextTable::Table ? std::cout : std::cerr;
+        statistics_stream << "Fetched \033[1;32m" << records->count_rows() << "\033[0m row"
+                          << (records->count_rows() == 1U ? "" : "s") << " in \033[1;33m"
+                          << records->execution_time_in_ms() << "\033[0m ms." << std::endl;
+
+        const auto &counters = records->performance_counters();
+        if (counters.cycles > 0u)
+        {
+            statistics_stream << "Cycles: " << counters.cycles << ", Instructions: " << counters.instructions
+                              << ", IPC: " << std::fixed << std::setprecision(2)
+                              << static_cast<double>(counters.instructions) / static_cast<double>(counters.cycles)
+                              << std::defaultfloat << ", L1 Misses: " << counters.l1_misses
+                              << ", LLC Misses: " << counters.llc_misses << std::endl;
+        }
+        this->_result_schema.reset();
+        this->_result_formatter.clear();
     }
     else if (server_response->type() == ServerResponse::Type::TransactionalResult)
     {
@@ -106,8 +213,32 @@ bool ClientConsole::handle_response(const std::string &response)
         const auto *plan = reinterpret_cast<const QueryPlanResponse *>(server_response);
         auto plan_json = nlohmann::json::parse(plan->payload());
         util::TextTable text_Table;
-        text_Table.header({"Operator", "Data", "Output"});
-        ClientConsole::plan_to_table(text_Table, plan_json);
+        const auto is_analyzed = plan_json.contains("time_ms");
+        const auto is_estimated = plan_json.contains("estimated_rows");
+        if (is_analyzed)
+        {
+            auto header = std::vector<std::string>{"Operator",  "Data",      "Estimated Rows", "Rows",
+                                                   "Next Calls", "Time (ms)", "Self (ms)",      "Pinned Pages",
+                                                   "Hits",       "Misses",    "Peak Memory"};
+            if (plan_json.contains("performance_counters"))
+            {
+                for (const auto &counter : plan_json["performance_counters"].items())
+                {
+                    header.emplace_back(counter.key());
+                }
+                header.emplace_back("IPC");
+            }
+            text_Table.header(std::move(header));
+        }
+        else if (is_estimated)
+        {
+            text_Table.header({"Operator", "Data", "Output", "Estimated Rows", "Actual Rows"});
+        }
+        else
+        {
+            text_Table.header({"Operator", "Data", "Output"});
+        }
+        ClientConsole::plan_to_table(text_Table, plan_json, is_estimated, is_analyzed);
         std::cout << text_Table << std::flush;
     }
     else if (server_response->type() == ServerResponse::Type::ServerClosed)
@@ -119,7 +250,8 @@ bool ClientConsole::handle_response(const std::string &response)
     return true;
 }
 
-void ClientConsole::plan_to_table(util::TextTable &table, nlohmann::json &layer, std::uint16_t depth)
+void ClientConsole::plan_to_table(util::TextTable &table, nlohmann::json &layer, const bool with_cardinality,
+                                  const bool with_statistics, std::uint16_t depth)
 {
     auto name = std::string(depth, ' ') + layer["name"].get<std::string>();
     auto data = layer.contains("data") ? layer["data"].get<std::string>() : "";
@@ -134,12 +266,67 @@ void ClientConsole::plan_to_table(util::TextTable &table, nlohmann::json &layer,
         output = output.substr(0, 50) + "...";
     }
 
-    table.push_back({std::move(name), std::move(data), std::move(output)});
+    if (with_statistics)
+    {
+        const auto to_string = [&layer](const std::string &key) {
+            return layer.contains(key) ? std::to_string(layer[key].get<std::uint64_t>()) : std::string{};
+        };
+        const auto to_time_string = [&layer](const std::string &key) {
+            auto stream = std::stringstream{};
+            if (layer.contains(key))
+            {
+                stream << std::fixed << std::setprecision(3) << layer[key].get<double>();
+            }
+            return stream.str();
+        };
+
+        auto row = std::vector<std::string>{std::move(name),
+                                            std::move(data),
+                                            to_string("estimated_rows"),
+                                            to_string("rows"),
+                                            to_string("next_calls"),
+                                            to_time_string("time_ms"),
+                                            to_time_string("exclusive_time_ms"),
+                                            to_string("pinned_pages"),
+                                            to_string("buffer_hits"),
+                                            to_string("buffer_misses"),
+                                            to_string("peak_memory_bytes")};
+
+        // Hardware performance counters are only present when enabled by ":set perf_counters 1".
+        if (layer.contains("performance_counters"))
+        {
+            for (const auto &counter : layer["performance_counters"].items())
+            {
+                row.emplace_back(std::to_string(counter.value().get<std::uint64_t>()));
+            }
+            auto ipc = std::stringstream{};
+            if (layer.contains("ipc"))
+            {
+                ipc << std::fixed << std::setprecision(2) << layer["ipc"].get<double>();
+            }
+            row.emplace_back(ipc.str());
+        }
+        table.push_back(std::move(row));
+    }
+    else if (with_cardinality)
+    {
+        auto estimated_rows =
+            layer.contains("estimated_rows") ? std::to_string(layer["estimated_rows"].get<std::uint64_t>()) : "";
+        auto actual_rows =
+            layer.contains("actual_rows") ? std::to_string(layer["actual_rows"].get<std::uint64_t>()) : "";
+        table.push_back(
+            {std::move(name), std::move(data), std::move(output), std::move(estimated_rows), std::move(actual_rows)});
+    }
+    else
+    {
+        table.push_back({std::move(name), std::move(data), std::move(output)});
+    }
+
     if (layer.contains("childs"))
     {
         for (auto &child : layer["childs"])
         {
-            plan_to_table(table, child, depth + 2);
+            plan_to_table(table, child, with_cardinality, with_statistics, depth + 2);
         }
     }
 }
\ No newline at end of file
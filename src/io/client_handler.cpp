@@ -20,28 +20,43 @@
  *------------------------------------------------------------------------------*
  */
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <exception/command_exception.h>
 #include <io/client_handler.h>
 #include <io/client_message_serializer.h>
 #include <io/executor.h>
-#include <io/query_result_serializer.h>
 #include <io/server_response.h>
+#include <regex>
+#include <util/perf.h>
 
 using namespace beedb::io;
 
 ClientHandler::ClientHandler(Database &database) noexcept
-    : _database(database), _commander(database), _client_transactions({nullptr})
+    : _database(database), _commander(database)
 {
-    this->_client_transactions.fill(nullptr);
 }
 
 std::optional<std::string> ClientHandler::handle_message(const std::uint32_t client_id, const std::string &message)
 {
     std::stringstream stream;
-    auto executor = Executor{this->_database, this->_client_transactions[client_id]};
-    auto result_serializer = ClientMessageSerializer{};
+    auto &client = this->client(client_id);
+    client.cancellation->reset();
+    auto &client_transaction = client.transaction;
+    auto executor = Executor{this->_database, client_transaction, client.cancellation.get()};
+    auto result_serializer = ClientMessageSerializer{
+        [this, client_id](const std::byte *data, const std::size_t size) {
+            this->network::ClientHandler::server()->send(client_id, data, size);
+        },
+        client.result_format};
 
-    if (command::Commander::is_command(message))
+    auto format_match = std::smatch{};
+    if (std::regex_match(message, format_match, std::regex{R"(:format\s+(\w+)\s*)", std::regex::icase}))
+    {
+        return std::make_optional(ClientHandler::negotiate_result_format(client, format_match[1].str()));
+    }
+    else if (command::Commander::is_command(message))
     {
         try
         {
@@ -52,11 +67,10 @@ std::optional<std::string> ClientHandler::handle_message(const std::uint32_t cli
                 {
                     return std::make_optional(ErrorResponse::build(result->error()));
                 }
-                else if (result_serializer.query_result().empty() == false)
+                else if (result_serializer.has_result())
                 {
-                    return std::make_optional(
-                        AnalyticalResponse::build(result->build_time().count() + result->execution_time().count(),
-                                                  result->count_tuples(), std::move(result_serializer.query_result())));
+                    result_serializer.flush();
+                    return std::make_optional(ClientHandler::analytical_response(result.value()));
                 }
                 else if (result_serializer.query_plan().empty() == false)
                 {
@@ -87,16 +101,15 @@ std::optional<std::string> ClientHandler::handle_message(const std::uint32_t cli
     }
     else
     {
-        TransactionCallback transaction_callback{this->_client_transactions[client_id]};
+        TransactionCallback transaction_callback{client_transaction};
         auto result = executor.execute(beedb::io::Query{message}, result_serializer, transaction_callback);
 
         if (result.is_successful())
         {
-            if (result_serializer.query_result().empty() == false)
+            if (result_serializer.has_result())
             {
-                return std::make_optional(
-                    AnalyticalResponse::build(result.build_time().count() + result.execution_time().count(),
-                                              result.count_tuples(), std::move(result_serializer.query_result())));
+                result_serializer.flush();
+                return std::make_optional(ClientHandler::analytical_response(result));
             }
             else
             {
@@ -110,15 +123,80 @@ std::optional<std::string> ClientHandler::handle_message(const std::uint32_t cli
     }
 }
 
-void ClientHandler::on_client_connected(const std::uint32_t)
+std::string ClientHandler::analytical_response(const ExecutionResult &result)
+{
+    auto performance_counters = AnalyticalResponse::PerformanceCounters{0u, 0u, 0u, 0u};
+    for (const auto &[name, value] : result.performance_counters())
+    {
+        const auto counter_value = static_cast<std::uint64_t>(std::llround(value));
+        if (name == util::Perf::CYCLES.name())
+        {
+            performance_counters.cycles = counter_value;
+        }
+        else if (name == util::Perf::INSTRUCTIONS.name())
+        {
+            performance_counters.instructions = counter_value;
+        }
+        else if (name == util::Perf::L1_MISSES.name())
+        {
+            performance_counters.l1_misses = counter_value;
+        }
+        else if (name == util::Perf::LLC_MISSES.name())
+        {
+            performance_counters.llc_misses = counter_value;
+        }
+    }
+
+    return AnalyticalResponse::build(result.build_time().count() + result.execution_time().count(),
+                                     result.count_tuples(), performance_counters);
+}
+
+void ClientHandler::on_client_connected(const std::uint32_t client_id)
 {
+    this->client(client_id) = Client{};
 }
 
 void ClientHandler::on_client_disconnected(const std::uint32_t client_id)
 {
-    if (this->_client_transactions[client_id] != nullptr)
+    auto *transaction = this->client(client_id).transaction;
+    if (transaction != nullptr)
     {
-        this->_database.transaction_manager().abort(*this->_client_transactions[client_id]);
-        this->_client_transactions[client_id] = nullptr;
+        this->_database.transaction_manager().abort(*transaction);
+        this->_database.transaction_manager().release(transaction);
     }
+
+    std::unique_lock _{this->_clients_latch};
+    this->_clients.erase(client_id);
+}
+
+void ClientHandler::on_cancel(const std::uint32_t client_id)
+{
+    std::unique_lock _{this->_clients_latch};
+    if (auto client = this->_clients.find(client_id); client != this->_clients.end())
+    {
+        client->second.cancellation->request();
+    }
+}
+
+std::string ClientHandler::negotiate_result_format(Client &client, std::string format)
+{
+    std::transform(format.begin(), format.end(), format.begin(), [](const auto c) { return std::tolower(c); });
+    if (format == "rows")
+    {
+        client.result_format = ResultFormat::Rows;
+    }
+    else if (format == "columns")
+    {
+        client.result_format = ResultFormat::Columns;
+    }
+    else if (format == "compressed")
+    {
+        client.result_format = ResultFormat::CompressedColumns;
+    }
+    else
+    {
+        return ErrorResponse::build("Unknown result format '" + format + "', use rows, columns, or compressed.");
+    }
+
+    return EmptyResponse::build();
 }
\ No newline at end of file
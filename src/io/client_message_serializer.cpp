@@ -0,0 +1,84 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <io/client_message_serializer.h>
+#include <io/columnar_result_serializer.h>
+#include <utility>
+#include <util/block_compressor.h>
+
+using namespace beedb::io;
+
+void ClientMessageSerializer::on_schema(const table::Schema &schema)
+{
+    this->_query_result_serializer.clear(sizeof(ResultSchemaResponse));
+    this->_query_result_serializer.serialize(schema);
+    new (this->_query_result_serializer.data()) ResultSchemaResponse();
+    this->_send(this->_query_result_serializer.data(), this->_query_result_serializer.size());
+
+    if (this->_result_format != ResultFormat::Rows)
+    {
+        this->_schema.emplace(schema);
+    }
+
+    this->_query_result_serializer.clear(sizeof(ResultRowsResponse));
+    this->_has_result = true;
+}
+
+void ClientMessageSerializer::flush()
+{
+    if (this->_count_chunk_rows == 0u)
+    {
+        return;
+    }
+
+    if (this->_result_format == ResultFormat::Rows)
+    {
+        new (this->_query_result_serializer.data()) ResultRowsResponse(this->_count_chunk_rows);
+        this->_send(this->_query_result_serializer.data(), this->_query_result_serializer.size());
+    }
+    else
+    {
+        const auto *rows = this->_query_result_serializer.data() + sizeof(ResultRowsResponse);
+        this->_columns.resize(sizeof(ResultColumnsResponse));
+        ColumnarResultSerializer::serialize(this->_schema.value(), rows, this->_count_chunk_rows, this->_columns);
+
+        // Columns are sent uncompressed, when compression does not pay off.
+        auto uncompressed_size = std::uint64_t(0u);
+        if (this->_result_format == ResultFormat::CompressedColumns)
+        {
+            const auto size = this->_columns.size() - sizeof(ResultColumnsResponse);
+            this->_compressed_columns.resize(sizeof(ResultColumnsResponse));
+            if (util::BlockCompressor::compress(this->_columns.data() + sizeof(ResultColumnsResponse), size,
+                                                this->_compressed_columns))
+            {
+                uncompressed_size = size;
+                std::swap(this->_columns, this->_compressed_columns);
+            }
+        }
+
+        new (this->_columns.data()) ResultColumnsResponse(this->_count_chunk_rows, uncompressed_size);
+        this->_send(this->_columns.data(), this->_columns.size());
+    }
+
+    this->_query_result_serializer.clear(sizeof(ResultRowsResponse));
+    this->_count_chunk_rows = 0u;
+}
@@ -0,0 +1,239 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <cstring>
+#include <io/columnar_result_serializer.h>
+#include <limits>
+#include <unordered_map>
+
+using namespace beedb::io;
+
+void ColumnarResultSerializer::serialize(const table::Schema &schema, const std::byte *rows,
+                                         const std::uint64_t count_rows, std::vector<std::byte> &data)
+{
+    std::unordered_map<std::string_view, std::uint32_t> dictionary;
+    std::vector<std::string_view> dictionary_values;
+
+    for (auto column_index = 0u; column_index < schema.size(); ++column_index)
+    {
+        const auto is_variable_length = schema.column(column_index).type() == table::Type::CHAR;
+        const auto length_size = is_variable_length ? sizeof(std::uint16_t) : 0u;
+
+        // Size of every encoding, to choose the smallest.
+        auto plain_size = std::size_t(0u);
+        auto run_length_size = sizeof(std::uint32_t);
+        auto dictionary_size = sizeof(std::uint32_t);
+        dictionary.clear();
+        dictionary_values.clear();
+
+        auto previous = std::string_view{};
+        for (auto row_index = 0u; row_index < count_rows; ++row_index)
+        {
+            const auto current = ColumnarResultSerializer::value(schema, rows, column_index, row_index);
+            plain_size += length_size + current.size();
+
+            if (row_index == 0u || current != previous)
+            {
+                run_length_size += sizeof(std::uint32_t) + length_size + current.size();
+            }
+            previous = current;
+
+            if (dictionary_values.size() <= max_dictionary_size &&
+                dictionary.try_emplace(current, std::uint32_t(dictionary_values.size())).second)
+            {
+                dictionary_values.push_back(current);
+                dictionary_size += length_size + current.size();
+            }
+        }
+
+        const auto index_size = dictionary_values.size() <= 256u ? sizeof(std::uint8_t) : sizeof(std::uint16_t);
+        dictionary_size += count_rows * index_size;
+        if (dictionary_values.size() > max_dictionary_size)
+        {
+            dictionary_size = std::numeric_limits<std::size_t>::max();
+        }
+
+        if (dictionary_size < plain_size && dictionary_size < run_length_size)
+        {
+            data.push_back(std::byte(Encoding::Dictionary));
+            ColumnarResultSerializer::write_integer(dictionary_values.size(), sizeof(std::uint32_t), data);
+            for (const auto dictionary_value : dictionary_values)
+            {
+                ColumnarResultSerializer::write_value(dictionary_value, is_variable_length, data);
+            }
+            for (auto row_index = 0u; row_index < count_rows; ++row_index)
+            {
+                const auto current = ColumnarResultSerializer::value(schema, rows, column_index, row_index);
+                ColumnarResultSerializer::write_integer(dictionary.at(current), index_size, data);
+            }
+        }
+        else if (run_length_size < plain_size)
+        {
+            data.push_back(std::byte(Encoding::RunLength));
+            const auto count_runs_index = data.size();
+            ColumnarResultSerializer::write_integer(0u, sizeof(std::uint32_t), data);
+
+            auto count_runs = std::uint32_t(0u);
+            auto run_begin = std::uint64_t(0u);
+            while (run_begin < count_rows)
+            {
+                const auto run_value = ColumnarResultSerializer::value(schema, rows, column_index, run_begin);
+                auto run_end = run_begin + 1u;
+                while (run_end < count_rows &&
+                       ColumnarResultSerializer::value(schema, rows, column_index, run_end) == run_value)
+                {
+                    ++run_end;
+                }
+
+                ColumnarResultSerializer::write_integer(run_end - run_begin, sizeof(std::uint32_t), data);
+                ColumnarResultSerializer::write_value(run_value, is_variable_length, data);
+                ++count_runs;
+                run_begin = run_end;
+            }
+            std::memcpy(&data[count_runs_index], &count_runs, sizeof(count_runs));
+        }
+        else
+        {
+            data.push_back(std::byte(Encoding::Plain));
+            for (auto row_index = 0u; row_index < count_rows; ++row_index)
+            {
+                ColumnarResultSerializer::write_value(
+                    ColumnarResultSerializer::value(schema, rows, column_index, row_index), is_variable_length, data);
+            }
+        }
+    }
+}
+
+void ColumnarResultSerializer::deserialize(const table::Schema &schema, const std::byte *data,
+                                           const std::uint64_t count_rows, std::vector<std::byte> &rows)
+{
+    const auto begin = rows.size();
+    rows.resize(begin + count_rows * schema.row_size(), std::byte{0});
+    auto *row_data = &rows[begin];
+
+    std::vector<std::string_view> dictionary_values;
+
+    auto index = std::size_t(0u);
+    for (auto column_index = 0u; column_index < schema.size(); ++column_index)
+    {
+        const auto type = schema.column(column_index).type();
+        const auto is_variable_length = type == table::Type::CHAR;
+        const auto offset = schema.offset(column_index);
+        const auto copy = [row_data, &schema, offset](const std::uint64_t row_index, const std::string_view value) {
+            std::memcpy(&row_data[row_index * schema.row_size() + offset], value.data(), value.size());
+        };
+
+        const auto encoding = Encoding(data[index++]);
+        if (encoding == Encoding::Dictionary)
+        {
+            const auto count_values = ColumnarResultSerializer::read_integer(data, index, sizeof(std::uint32_t));
+            dictionary_values.clear();
+            for (auto i = 0u; i < count_values; ++i)
+            {
+                dictionary_values.push_back(
+                    ColumnarResultSerializer::read_value(data, index, type.size(), is_variable_length));
+            }
+
+            const auto index_size = count_values <= 256u ? sizeof(std::uint8_t) : sizeof(std::uint16_t);
+            for (auto row_index = 0u; row_index < count_rows; ++row_index)
+            {
+                copy(row_index, dictionary_values[ColumnarResultSerializer::read_integer(data, index, index_size)]);
+            }
+        }
+        else if (encoding == Encoding::RunLength)
+        {
+            const auto count_runs = ColumnarResultSerializer::read_integer(data, index, sizeof(std::uint32_t));
+            auto row_index = std::uint64_t(0u);
+            for (auto i = 0u; i < count_runs; ++i)
+            {
+                const auto run_length = ColumnarResultSerializer::read_integer(data, index, sizeof(std::uint32_t));
+                const auto run_value =
+                    ColumnarResultSerializer::read_value(data, index, type.size(), is_variable_length);
+                for (auto j = 0u; j < run_length; ++j)
+                {
+                    copy(row_index++, run_value);
+                }
+            }
+        }
+        else
+        {
+            for (auto row_index = 0u; row_index < count_rows; ++row_index)
+            {
+                copy(row_index, ColumnarResultSerializer::read_value(data, index, type.size(), is_variable_length));
+            }
+        }
+    }
+}
+
+std::string_view ColumnarResultSerializer::value(const table::Schema &schema, const std::byte *rows,
+                                                 const std::uint16_t column_index, const std::uint64_t row_index)
+{
+    const auto *value =
+        reinterpret_cast<const char *>(&rows[row_index * schema.row_size() + schema.offset(column_index)]);
+    const auto &type = schema.column(column_index).type();
+    if (type == table::Type::CHAR)
+    {
+        return std::string_view{value, ::strnlen(value, type.size())};
+    }
+
+    return std::string_view{value, type.size()};
+}
+
+void ColumnarResultSerializer::write_value(const std::string_view value, const bool is_variable_length,
+                                           std::vector<std::byte> &data)
+{
+    if (is_variable_length)
+    {
+        ColumnarResultSerializer::write_integer(value.size(), sizeof(std::uint16_t), data);
+    }
+
+    const auto *bytes = reinterpret_cast<const std::byte *>(value.data());
+    data.insert(data.end(), bytes, bytes + value.size());
+}
+
+void ColumnarResultSerializer::write_integer(const std::uint32_t value, const std::size_t size,
+                                             std::vector<std::byte> &data)
+{
+    const auto *bytes = reinterpret_cast<const std::byte *>(&value);
+    data.insert(data.end(), bytes, bytes + size);
+}
+
+std::string_view ColumnarResultSerializer::read_value(const std::byte *data, std::size_t &index,
+                                                      const std::uint16_t size, const bool is_variable_length)
+{
+    const auto length = is_variable_length ? ColumnarResultSerializer::read_integer(data, index, sizeof(std::uint16_t))
+                                           : std::uint32_t(size);
+    const auto value = std::string_view{reinterpret_cast<const char *>(&data[index]), length};
+    index += length;
+
+    return value;
+}
+
+std::uint32_t ColumnarResultSerializer::read_integer(const std::byte *data, std::size_t &index,
+                                                     const std::size_t size)
+{
+    auto value = std::uint32_t(0u);
+    std::memcpy(&value, &data[index], size);
+    index += size;
+
+    return value;
+}
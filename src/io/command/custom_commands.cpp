@@ -23,6 +23,7 @@
 #include <exception/command_exception.h>
 #include <io/command/custom_commands.h>
 #include <regex>
+#include <util/clock.h>
 
 using namespace beedb::io::command;
 
@@ -59,7 +60,7 @@ std::optional<beedb::io::ExecutionResult> ShowCommand::execute(const std::string
 std::optional<beedb::io::ExecutionResult> ExplainCommand::execute(const std::string &input, Executor &executor,
                                                                   ExecutionCallback &execution_callback)
 {
-    std::regex explain_regex("([plan]*)\\s(.*)", std::regex::icase);
+    std::regex explain_regex("([plan]*|analyze)\\s(.*)", std::regex::icase);
     std::smatch explain_regex_match;
 
     if (std::regex_match(input, explain_regex_match, explain_regex))
@@ -69,6 +70,10 @@ std::optional<beedb::io::ExecutionResult> ExplainCommand::execute(const std::str
             Query q;
             return executor.execute(Query{explain_regex_match[2], Query::ExplainLevel::Plan}, execution_callback);
         }
+        else if (explain_regex_match[1].str() == "analyze")
+        {
+            return executor.execute(Query{explain_regex_match[2], Query::ExplainLevel::Analyze}, execution_callback);
+        }
         //        else if (explain_regex_match[1].str() == "graph")
         //        {
         //            return executor.execute(Query{explain_regex_match[2], Query::ExplainLevel::Graph},
@@ -177,11 +182,30 @@ std::optional<beedb::io::ExecutionResult> StatsCommand::execute(const std::strin
             throw exception::CommandException("Table not found!");
         }
 
-        // create execution plan, that performs statistic computations:
-        // TODO: Need transaction here
-        //        auto plan = plan::physical::Builder::build_statistics_plan(_db, input);
-        //
-        //        return _executor.execute(plan); // execute operator right away
+        // Scan the table and compute the statistics within an own transaction.
+        auto *transaction = _db.transaction_manager().new_transaction();
+        util::Clock execution_clock{};
+        auto count_rows = std::uint64_t{0u};
+        try
+        {
+            count_rows = _db.analyze(transaction, *_db.table(input));
+        }
+        catch (...)
+        {
+            _db.transaction_manager().abort(*transaction);
+            _db.transaction_manager().release(transaction);
+            throw;
+        }
+        const auto execution_time = execution_clock.end();
+
+        const auto is_committed = _db.transaction_manager().commit(*transaction);
+        _db.transaction_manager().release(transaction);
+        if (is_committed == false)
+        {
+            return ExecutionResult{std::string{"Could not persist statistics due to concurrent modification."}};
+        }
+
+        return ExecutionResult{count_rows, std::chrono::milliseconds{0}, execution_time, 0u};
     }
     else if (input.empty())
     {
@@ -23,24 +23,76 @@
 #include <chrono>
 #include <exception/concurrency_exception.h>
 #include <exception/exception.h>
+#include <exception/execution_exception.h>
 #include <io/executor.h>
 #include <iostream>
 #include <parser/sql_parser.h>
 #include <plan/logical/builder.h>
+#include <plan/logical/cardinality_estimator.h>
+#include <plan/logical/plan_view.h>
 #include <plan/optimizer/optimizer.h>
 #include <plan/physical/builder.h>
 #include <util/clock.h>
+#include <util/perf.h>
+#include <utility>
+#include <vector>
 
 using namespace beedb::io;
 
 ExecutionResult Executor::execute(const Query &query, ExecutionCallback &execution_callback,
                                   concurrency::TransactionCallback &transaction_callback)
+{
+    // Transactions ended by the statement (single transactions, commit, or abort)
+    // are released once the executor does not use them anymore.
+    auto *ended_transaction = static_cast<concurrency::Transaction *>(nullptr);
+    auto releasing_transaction_callback = concurrency::FunctionTransactionCallback{
+        [&transaction_callback](concurrency::Transaction *transaction) { transaction_callback.on_begin(transaction); },
+        [&transaction_callback, &ended_transaction](concurrency::Transaction *transaction, const bool successful) {
+            transaction_callback.on_end(transaction, successful);
+            ended_transaction = transaction;
+        }};
+    const auto release = [this, &ended_transaction] {
+        if (ended_transaction != nullptr)
+        {
+            if (this->_transaction == ended_transaction)
+            {
+                this->_transaction = nullptr;
+            }
+            this->_database.transaction_manager().release(ended_transaction);
+        }
+    };
+
+    try
+    {
+        auto result = this->execute_statement(query, execution_callback, releasing_transaction_callback);
+        release();
+        return result;
+    }
+    catch (...)
+    {
+        release();
+        throw;
+    }
+}
+
+ExecutionResult Executor::execute_statement(const Query &query, ExecutionCallback &execution_callback,
+                                            concurrency::TransactionCallback &transaction_callback)
 {
     std::chrono::milliseconds planning_time{}, execution_time{};
 
+    // A transaction started only for this statement ends with the statement, also when it failed.
+    bool is_single_transaction = false;
+    const auto abort_single_transaction = [this, &is_single_transaction, &transaction_callback] {
+        if (is_single_transaction)
+        {
+            is_single_transaction = false;
+            this->_database.transaction_manager().abort(*this->_transaction);
+            transaction_callback.on_end(this->_transaction, false);
+        }
+    };
+
     try
     {
-        bool is_single_transaction = false;
 
         ////////////////////////////////////////////////////////////////////////
         /// \brief parser this object offers all components of the posed query,
@@ -50,14 +102,22 @@ ExecutionResult Executor::execute(const Query &query, ExecutionCallback &executi
         ////////////////////////////////////////////////////////////////////////
         /// \brief Start a single transaction around this query if no
         /// transaction was started and this query is no (begin|commit|abort)
-        /// transaction query.
+        /// transaction query. A single SELECT runs read-only.
         if (this->_transaction == nullptr && typeid(*ast) != typeid(parser::TransactionStatement))
         {
             is_single_transaction = true;
-            this->_transaction = this->_database.transaction_manager().new_transaction();
+            this->_transaction = this->_database.transaction_manager().new_transaction(
+                concurrency::IsolationLevel::Serializable, typeid(*ast) == typeid(parser::SelectQuery));
             transaction_callback.on_begin(this->_transaction);
         }
 
+        /// The logical plan takes the table names from the statement.
+        auto *modified_table = this->modified_table(ast);
+        if (modified_table != nullptr && this->_transaction->is_read_only())
+        {
+            throw beedb::exception::ReadOnlyTransactionException();
+        }
+
         util::Clock planning_clock{}; // we do not measure parsing time
         const auto before_query_evicted_frames = this->_database.buffer_manager().evicted_frames();
 
@@ -66,9 +126,12 @@ ExecutionResult Executor::execute(const Query &query, ExecutionCallback &executi
         /// This plan has no optimizations at all.
         auto logical_plan = beedb::plan::logical::Builder::build(this->_database, ast);
 
-        /// In case this is a SELECT query and optimization is enabled...
-        if (typeid(*ast) == typeid(parser::SelectQuery) &&
-            !(this->_database.config()[Config::k_OptimizationDisableOptimization]))
+        /// In case this is a SELECT, UPDATE or DELETE query and optimization is enabled...
+        /// UPDATE and DELETE locate their rows like a SELECT does, e.g. using index scans.
+        const auto is_optimizable = typeid(*ast) == typeid(parser::SelectQuery) ||
+                                    typeid(*ast) == typeid(parser::UpdateStatement) ||
+                                    typeid(*ast) == typeid(parser::DeleteStatement);
+        if (is_optimizable && !(this->_database.config()[Config::k_OptimizationDisableOptimization]))
         {
             ////////////////////////////////////////////////////////////////////////
             /// \brief optimizer holds a reference to the canonical plan and can create a new, optimized plan
@@ -77,7 +140,18 @@ ExecutionResult Executor::execute(const Query &query, ExecutionCallback &executi
             logical_plan = optimizer.optimize(std::move(logical_plan));
         }
 
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief Annotate the plan with estimated cardinalities; the actual
+        ///        cardinalities are recorded while executing.
+        const auto is_estimated = is_optimizable;
+        auto cardinality_estimator = plan::logical::CardinalityEstimator{this->_database};
+        if (is_estimated)
+        {
+            cardinality_estimator.estimate(logical_plan);
+        }
+
         auto count_tuples = 0u;
+        auto performance_counters = std::vector<std::pair<std::string, double>>{};
         if (query.explain == Query::ExplainLevel::Plan)
         {
             planning_time = planning_clock.end();
@@ -85,15 +159,98 @@ ExecutionResult Executor::execute(const Query &query, ExecutionCallback &executi
         }
         else
         {
+            ////////////////////////////////////////////////////////////////////////
+            /// \brief Hardware performance counters of the executing thread, when enabled
+            ///        and permitted by the system (see /proc/sys/kernel/perf_event_paranoid).
+            auto perf = util::Perf{};
+            if (static_cast<bool>(this->_database.config()[Config::k_PerfCounters]))
+            {
+                perf.add(util::Perf::CYCLES);
+                perf.add(util::Perf::INSTRUCTIONS);
+                perf.add(util::Perf::L1_MISSES);
+                perf.add(util::Perf::LLC_MISSES);
+            }
+
+            ////////////////////////////////////////////////////////////////////////
+            /// \brief Operators of nodes holding statistics record their runtime
+            ///        statistics; only when analyzing, since recording costs time.
+            if (query.explain == Query::ExplainLevel::Analyze)
+            {
+                for (auto &[node, _] : plan::logical::PlanView{logical_plan}.nodes_and_parent())
+                {
+                    node->operator_statistics().emplace().perf = perf.empty() ? nullptr : &perf;
+                }
+            }
+
             ////////////////////////////////////////////////////////////////////////
             /// create the physical plan from the logical one:
+            /// Only serializable transactions validate their scans.
+            const auto add_to_scan_set = this->_transaction == nullptr || this->_transaction->is_validating_reads();
             auto plan = beedb::plan::physical::Builder::build(this->_database, this->_transaction, transaction_callback,
-                                                              true, logical_plan);
+                                                              add_to_scan_set, logical_plan);
             planning_time = planning_clock.end();
 
+            ////////////////////////////////////////////////////////////////////////
+            /// \brief Operators check the cancellation of the statement through the transaction.
+            if (this->_cancellation != nullptr && this->_transaction != nullptr)
+            {
+                const auto timeout = static_cast<std::uint32_t>(this->_database.config()[Config::k_StatementTimeout]);
+                this->_cancellation->start(std::chrono::milliseconds{timeout});
+                this->_transaction->cancellation(this->_cancellation);
+            }
+
             util::Clock execution_clock{};
-            count_tuples = plan.execute(execution_callback);
+            perf.start();
+            try
+            {
+                // Cancels requested while parsing and planning.
+                if (this->_cancellation != nullptr)
+                {
+                    this->_cancellation->check();
+                }
+
+                if (query.explain == Query::ExplainLevel::Analyze)
+                {
+                    SilentExecutionCallback silent_execution_callback;
+                    count_tuples = plan.execute(silent_execution_callback);
+                }
+                else
+                {
+                    count_tuples = plan.execute(execution_callback);
+                }
+            }
+            catch (...)
+            {
+                if (this->_transaction != nullptr)
+                {
+                    this->_transaction->cancellation(nullptr);
+                }
+                throw;
+            }
+            perf.stop();
             execution_time = execution_clock.end();
+
+            for (const auto &counter : perf.counter())
+            {
+                performance_counters.emplace_back(counter.name(), counter.read());
+            }
+
+            if (this->_transaction != nullptr)
+            {
+                this->_transaction->cancellation(nullptr);
+            }
+
+            ////////////////////////////////////////////////////////////////////////
+            /// \brief Learn from misestimated predicates for later queries.
+            if (is_estimated)
+            {
+                cardinality_estimator.learn(logical_plan);
+            }
+
+            if (query.explain == Query::ExplainLevel::Analyze)
+            {
+                execution_callback.on_plan(logical_plan);
+            }
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -101,6 +258,7 @@ ExecutionResult Executor::execute(const Query &query, ExecutionCallback &executi
         ///        the transaction directly.
         if (is_single_transaction)
         {
+            is_single_transaction = false;
             const auto committed = this->_database.transaction_manager().commit(*this->_transaction);
             transaction_callback.on_end(this->_transaction, committed);
 
@@ -110,24 +268,72 @@ ExecutionResult Executor::execute(const Query &query, ExecutionCallback &executi
             }
         }
 
+        ////////////////////////////////////////////////////////////////////////
+        /// \brief Count modified rows; the table may be analyzed in background
+        ///        when too many rows were modified.
+        if (modified_table != nullptr && modified_table->is_virtual() == false &&
+            query.explain != Query::ExplainLevel::Plan && count_tuples > 0u)
+        {
+            this->_database.modified(*modified_table, count_tuples);
+        }
+
         const auto final_evicted_frames =
             this->_database.buffer_manager().evicted_frames() - before_query_evicted_frames;
 
-        return ExecutionResult{count_tuples, planning_time, execution_time, final_evicted_frames};
+        return ExecutionResult{count_tuples, planning_time, execution_time, final_evicted_frames,
+                               std::move(performance_counters)};
     }
     catch (beedb::exception::AbortTransactionException &e)
     {
         this->_database.transaction_manager().abort(*this->_transaction);
+        abort_single_transaction();
+        return ExecutionResult{std::string(e.what())};
+    }
+    catch (beedb::exception::QueryCancelledException &e)
+    {
+        /// A cancelled statement aborts its transaction.
+        if (this->_transaction != nullptr)
+        {
+            this->_database.transaction_manager().abort(*this->_transaction);
+            transaction_callback.on_end(this->_transaction, false);
+            this->_transaction = nullptr;
+        }
         return ExecutionResult{std::string(e.what())};
     }
     catch (std::runtime_error &e)
     {
+        abort_single_transaction();
         return ExecutionResult{std::string(e.what())};
     }
     catch (beedb::exception::DatabaseException &e)
     {
+        abort_single_transaction();
         return ExecutionResult{std::string(e.what())};
     }
+    catch (...)
+    {
+        // E.g., thrown by callbacks.
+        abort_single_transaction();
+        throw;
+    }
+}
+
+beedb::table::Table *Executor::modified_table(const std::unique_ptr<parser::NodeInterface> &ast)
+{
+    if (typeid(*ast) == typeid(parser::InsertStatement))
+    {
+        return this->_database.table(reinterpret_cast<parser::InsertStatement *>(ast.get())->table_name());
+    }
+    else if (typeid(*ast) == typeid(parser::UpdateStatement))
+    {
+        return this->_database.table(reinterpret_cast<parser::UpdateStatement *>(ast.get())->table_name());
+    }
+    else if (typeid(*ast) == typeid(parser::DeleteStatement))
+    {
+        return this->_database.table(reinterpret_cast<parser::DeleteStatement *>(ast.get())->table_name());
+    }
+
+    return nullptr;
 }
 
 ExecutionResult Executor::execute(plan::physical::Plan &plan, ExecutionCallback &execution_callback)
@@ -188,7 +188,16 @@ void FileExecutor::execute_statements(std::vector<std::string> &&statements)
                   << std::flush;
     }
 
-    if (this->_database.transaction_manager().commit(*this->_transaction))
+    // The file may have ended the transaction itself.
+    if (this->_transaction == nullptr)
+    {
+        return;
+    }
+
+    const auto is_committed = this->_database.transaction_manager().commit(*this->_transaction);
+    this->_database.transaction_manager().release(this->_transaction);
+    this->_transaction = nullptr;
+    if (is_committed)
     {
         std::cout << "\r"
                   << "\033[0;32m"
@@ -20,13 +20,14 @@
  *------------------------------------------------------------------------------*
  */
 
+#include <algorithm>
 #include <io/query_result_serializer.h>
 
 using namespace beedb::io;
 
-QueryResultSerializer::QueryResultSerializer()
+QueryResultSerializer::QueryResultSerializer(const std::size_t capacity)
 {
-    _capacity = 1024u;
+    _capacity = std::max(capacity, std::size_t(64u));
     _data = static_cast<std::byte *>(std::malloc(_capacity));
 }
 
@@ -115,35 +116,87 @@ void QueryResultSerializer::serialize(const table::Schema &schema)
         current_index += attribute.column_name().size() + 1;
     }
 
-    this->prepend(tuple_metadata, needed_size);
+    this->append(tuple_metadata, needed_size);
     delete[] tuple_metadata;
 }
 
-void QueryResultSerializer::serialize(const table::Tuple &tuple)
+beedb::table::Schema QueryResultSerializer::deserialize(const std::byte *data)
 {
-    this->append(tuple.data(), tuple.schema().row_size());
-}
+    auto current_index = 0u;
+    const auto count_columns = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
+    current_index += sizeof(std::uint16_t);
 
-void QueryResultSerializer::append(const std::byte *data, const std::uint16_t size)
-{
-    while (this->_capacity < this->_size + size)
+    const auto row_size = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
+    current_index += sizeof(std::uint16_t);
+
+    std::vector<table::Column> columns;
+    columns.reserve(count_columns);
+    std::vector<std::uint16_t> offsets;
+    offsets.reserve(count_columns);
+
+    for (auto i = 0u; i < count_columns; ++i)
     {
-        this->allocate(this->_capacity << 1);
+        const auto type = *reinterpret_cast<const table::Type *>(&data[current_index]);
+        current_index += sizeof(decltype(type));
+        columns.emplace_back(table::Column{type});
+
+        const auto offset = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
+        current_index += sizeof(decltype(offset));
+        offsets.push_back(offset);
     }
 
-    std::memcpy(&this->_data[this->_size], data, size);
-    this->_size += size;
+    const auto count_terms = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
+    current_index += sizeof(std::uint16_t);
+
+    std::vector<expression::Term> terms;
+    terms.reserve(count_terms);
+    std::vector<std::uint16_t> orders;
+    orders.reserve(count_terms);
+
+    for (auto i = 0u; i < count_terms; ++i)
+    {
+        const auto order = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
+        current_index += sizeof(decltype(order));
+        orders.push_back(order);
+
+        std::optional<std::string> alias = std::nullopt;
+        if (*reinterpret_cast<const char *>(&data[current_index]) != '\0')
+        {
+            alias = std::make_optional(std::string{reinterpret_cast<const char *>(&data[current_index])});
+            current_index += alias->size();
+        }
+        current_index += 1;
+
+        std::optional<std::string> table_name = std::nullopt;
+        if (*reinterpret_cast<const char *>(&data[current_index]) != '\0')
+        {
+            table_name = std::make_optional(std::string{reinterpret_cast<const char *>(&data[current_index])});
+            current_index += table_name->size();
+        }
+        current_index += 1;
+
+        auto column_name = std::string{reinterpret_cast<const char *>(&data[current_index])};
+        current_index += column_name.size() + 1;
+        terms.emplace_back(
+            expression::Term{expression::Attribute{std::move(table_name), std::move(column_name)}, std::move(alias)});
+    }
+
+    return table::Schema{std::move(columns), std::move(terms), std::move(offsets), std::move(orders), row_size};
+}
+
+void QueryResultSerializer::serialize(const table::Tuple &tuple)
+{
+    this->append(tuple.data(), tuple.schema().row_size());
 }
 
-void QueryResultSerializer::prepend(const std::byte *data, const std::uint16_t size)
+void QueryResultSerializer::append(const std::byte *data, const std::uint16_t size)
 {
     while (this->_capacity < this->_size + size)
     {
         this->allocate(this->_capacity << 1);
     }
 
-    std::memmove(&this->_data[size], this->_data, size);
-    std::memcpy(this->_data, data, size);
+    std::memcpy(&this->_data[this->_size], data, size);
     this->_size += size;
 }
 
@@ -55,83 +55,74 @@ void ResultOutputFormatter::push_back(const std::vector<table::Tuple> &tuples)
         this->push_back(row);
     }
 }
-ResultOutputFormatter ResultOutputFormatter::from_serialized_data(const std::size_t count_records,
-                                                                  const std::byte *data)
-{
-    ResultOutputFormatter formatter;
-
-    auto current_index = 0u;
-    const auto count_columns = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
-    current_index += sizeof(std::uint16_t);
-
-    const auto row_size = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
-    current_index += sizeof(std::uint16_t);
-
-    std::vector<table::Column> columns;
-    columns.reserve(count_columns);
-    std::vector<std::uint16_t> offsets;
-    offsets.reserve(count_columns);
 
-    for (auto i = 0u; i < count_columns; ++i)
+void ResultOutputFormatter::push_back(const beedb::table::Schema &schema, const std::size_t count_tuples,
+                                      const std::byte *data)
+{
+    for (auto i = 0u; i < count_tuples; ++i)
     {
-        const auto type = *reinterpret_cast<const table::Type *>(&data[current_index]);
-        current_index += sizeof(decltype(type));
-        columns.emplace_back(table::Column{type});
-
-        const auto offset = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
-        current_index += sizeof(decltype(offset));
-        offsets.push_back(offset);
+        auto *tuple_data = const_cast<std::byte *>(&data[i * schema.row_size()]);
+        table::Tuple tuple{schema, storage::RecordIdentifier{storage::Page::MEMORY_TABLE_PAGE_ID, 0u}, nullptr,
+                           tuple_data};
+        this->push_back(tuple);
     }
+}
+
+void StreamingResultOutputFormatter::header(const beedb::table::Schema &schema)
+{
+    std::vector<std::string> header;
+    std::transform(schema.terms().cbegin(), schema.terms().cend(), std::back_inserter(header),
+                   [](const auto &term) -> std::string { return static_cast<std::string>(term); });
 
-    const auto count_terms = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
-    current_index += sizeof(std::uint16_t);
+    std::vector<std::size_t> column_lengths;
+    std::transform(schema.column_order().cbegin(), schema.column_order().cend(), std::back_inserter(column_lengths),
+                   [&schema](const auto index) { return printed_length(schema[index].type()); });
 
-    std::vector<expression::Term> terms;
-    terms.reserve(count_terms);
-    std::vector<std::uint16_t> orders;
-    orders.reserve(count_terms);
+    this->_table.header(std::move(header), std::move(column_lengths));
+    this->_count_tuples = 0u;
+}
 
-    for (auto i = 0u; i < count_terms; ++i)
+void StreamingResultOutputFormatter::push_back(const beedb::table::Tuple &tuple)
+{
+    if (tuple.has_data())
     {
-        const auto order = *reinterpret_cast<const std::uint16_t *>(&data[current_index]);
-        current_index += sizeof(decltype(order));
-        orders.push_back(order);
-
-        std::optional<std::string> alias = std::nullopt;
-        if (*reinterpret_cast<const char *>(&data[current_index]) != '\0')
-        {
-            alias = std::make_optional(std::string{reinterpret_cast<const char *>(&data[current_index])});
-            current_index += alias->size();
-        }
-        current_index += 1;
-
-        std::optional<std::string> table_name = std::nullopt;
-        if (*reinterpret_cast<const char *>(&data[current_index]) != '\0')
-        {
-            table_name = std::make_optional(std::string{reinterpret_cast<const char *>(&data[current_index])});
-            current_index += table_name->size();
-        }
-        current_index += 1;
-
-        auto column_name = std::string{reinterpret_cast<const char *>(&data[current_index])};
-        current_index += column_name.size() + 1;
-        terms.emplace_back(
-            expression::Term{expression::Attribute{std::move(table_name), std::move(column_name)}, std::move(alias)});
-    }
+        std::vector<std::string> row;
+        std::transform(
+            tuple.schema().column_order().cbegin(), tuple.schema().column_order().cend(), std::back_inserter(row),
+            [&tuple](const auto index) -> std::string { return static_cast<std::string>(tuple.get(index)); });
 
-    table::Schema schema{std::move(columns), std::move(terms), std::move(offsets), std::move(orders), row_size};
-    formatter.header(schema);
+        this->_table.push_back(std::move(row));
+        this->_count_tuples++;
+    }
+}
 
-    for (auto i = 0u; i < count_records; ++i)
+void StreamingResultOutputFormatter::push_back(const beedb::table::Schema &schema, const std::size_t count_tuples,
+                                               const std::byte *data)
+{
+    for (auto i = 0u; i < count_tuples; ++i)
     {
-        auto *tuple_data = const_cast<std::byte *>(&data[current_index]);
+        auto *tuple_data = const_cast<std::byte *>(&data[i * schema.row_size()]);
         table::Tuple tuple{schema, storage::RecordIdentifier{storage::Page::MEMORY_TABLE_PAGE_ID, 0u}, nullptr,
                            tuple_data};
-        formatter.push_back(tuple);
-        current_index += schema.row_size();
+        this->push_back(tuple);
     }
+}
 
-    return formatter;
+std::size_t StreamingResultOutputFormatter::printed_length(const beedb::table::Type &type)
+{
+    switch (type)
+    {
+    case table::Type::INT:
+        return 11u;
+    case table::Type::LONG:
+        return 20u;
+    case table::Type::DATE:
+        return 10u;
+    case table::Type::CHAR:
+        return type.dynamic_length();
+    default:
+        return 0u;
+    }
 }
 
 namespace beedb::io
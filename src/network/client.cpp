@@ -20,10 +20,14 @@
  *------------------------------------------------------------------------------*
  */
 
+#include <array>
+#include <cerrno>
+#include <cstddef>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <network/client.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 using namespace beedb::network;
@@ -74,14 +78,63 @@ void Client::disconnect() const
 
 std::string Client::send(const std::string &message)
 {
-    const auto w = ::write(this->_socket, message.data(), message.size());
-    if (w < 0)
+    if (this->send_request(message) == false)
     {
         return std::string("Error on sending message.");
     }
 
+    return this->receive();
+}
+
+bool Client::send_request(const std::string &message)
+{
+    // Requests are framed like responses: Length header, followed by the message.
+    const auto length = frame_header_t(message.size());
+    std::array<iovec, 2> buffers{iovec{const_cast<frame_header_t *>(&length), sizeof(length)},
+                                 iovec{const_cast<char *>(message.data()), message.size()}};
+    auto *buffer = buffers.data();
+    auto count_buffers = buffers.size();
+
+    while (count_buffers > 0u)
+    {
+        const auto written = ::writev(this->_socket, buffer, count_buffers);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+
+        auto remaining = std::size_t(written);
+        while (count_buffers > 0u && remaining >= buffer->iov_len)
+        {
+            remaining -= buffer->iov_len;
+            ++buffer;
+            --count_buffers;
+        }
+        if (count_buffers > 0u)
+        {
+            buffer->iov_base = static_cast<std::byte *>(buffer->iov_base) + remaining;
+            buffer->iov_len -= remaining;
+        }
+    }
+
+    return true;
+}
+
+void Client::cancel() const
+{
+    // Only async-signal-safe calls, the cancel may be sent by a signal handler.
+    const auto header = cancel_frame_header;
+    [[maybe_unused]] const auto _ = ::write(this->_socket, &header, sizeof(header));
+}
+
+std::string Client::receive()
+{
     // Read header
-    auto header = std::uint64_t(0);
+    auto header = frame_header_t(0);
     this->read_into_buffer(sizeof(header), static_cast<void *>(&header));
 
     // Read data
@@ -20,21 +20,26 @@
  *------------------------------------------------------------------------------*
  */
 
+
 #include <algorithm>
+#include <cerrno>
 #include <cstring>
+#include <fcntl.h>
 #include <iostream>
 #include <limits>
 #include <netinet/in.h>
 #include <network/server.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 using namespace beedb::network;
 
-Server::Server(ClientHandler &handler, std::uint16_t port) noexcept
-    : _port(port), _socket(-1), _client_sockets({0}), _buffer({'\0'}), _handler(handler)
+Server::Server(ClientHandler &handler, std::uint16_t port, std::uint16_t count_workers) noexcept
+    : _port(port), _count_workers(std::max<std::uint16_t>(count_workers, 1u)), _socket(-1), _epoll(-1),
+      _buffer({'\0'}), _handler(handler)
 {
-    this->_buffer.fill('\0');
     handler.server(this);
 }
 
@@ -62,109 +67,465 @@ bool Server::listen()
         return false;
     }
 
-    if (::listen(this->_socket, 3) < 0)
+    if (::listen(this->_socket, SOMAXCONN) < 0)
+    {
+        return false;
+    }
+
+    // Edge-triggered events require to accept until the socket would block.
+    if (fcntl(this->_socket, F_SETFL, fcntl(this->_socket, F_GETFL) | O_NONBLOCK) < 0)
     {
         return false;
     }
 
+    if (pipe(this->_wake_up_pipe.data()) < 0)
+    {
+        return false;
+    }
+
+    this->_epoll = epoll_create1(0);
+    if (this->_epoll < 0)
+    {
+        return false;
+    }
+
+    epoll_event listen_event{};
+    listen_event.events = EPOLLIN | EPOLLET;
+    listen_event.data.u64 = Server::listen_event_id;
+    epoll_event wake_up_event{};
+    wake_up_event.events = EPOLLIN;
+    wake_up_event.data.u64 = Server::wake_up_event_id;
+    if (epoll_ctl(this->_epoll, EPOLL_CTL_ADD, this->_socket, &listen_event) < 0 ||
+        epoll_ctl(this->_epoll, EPOLL_CTL_ADD, this->_wake_up_pipe[0], &wake_up_event) < 0)
+    {
+        return false;
+    }
+
+    for (auto i = 0u; i < this->_count_workers; ++i)
+    {
+        this->_workers.emplace_back(&Server::work, this);
+    }
+
     auto address_length = socklen_t{sizeof(sockaddr_in)};
-    fd_set socket_descriptors;
-    auto max_socket_descriptor = this->_socket;
-    std::int32_t socket_descriptor, client_socket;
+    std::array<epoll_event, 256> events;
+    std::int32_t client_socket;
 
     while (this->_is_running)
     {
-        FD_ZERO(&socket_descriptors);
-        FD_SET(this->_socket, &socket_descriptors);
-
-        for (auto i = 0u; i < this->_client_sockets.size(); ++i)
+        const auto count_events = epoll_wait(this->_epoll, events.data(), events.size(), -1);
+        for (auto i = 0; i < count_events; ++i)
         {
-            socket_descriptor = this->_client_sockets[i];
-            if (socket_descriptor > 0)
+            const auto event_data = events[i].data.u64;
+            if (event_data == Server::wake_up_event_id)
             {
-                FD_SET(socket_descriptor, &socket_descriptors);
+                char wake_up;
+                [[maybe_unused]] const auto _ = read(this->_wake_up_pipe[0], &wake_up, sizeof(wake_up));
             }
+            else if (event_data == Server::listen_event_id)
+            {
+                // Client sockets do not block, neither on receiving nor on sending responses.
+                while ((client_socket = accept4(this->_socket, reinterpret_cast<sockaddr *>(&address),
+                                                &address_length, SOCK_NONBLOCK)) >= 0)
+                {
+                    const auto id = this->add_client(client_socket);
+                    epoll_event client_event{};
+                    client_event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+                    client_event.data.u64 = id;
+                    if (epoll_ctl(this->_epoll, EPOLL_CTL_ADD, client_socket, &client_event) < 0)
+                    {
+                        this->close(id);
+                        continue;
+                    }
+                    this->_handler.on_client_connected(id);
+                }
+            }
+            else
+            {
+                // The client read data, queued responses may fit into the socket now.
+                if ((events[i].events & EPOLLOUT) != 0u)
+                {
+                    this->flush(static_cast<std::uint32_t>(event_data));
+                }
 
-            max_socket_descriptor = std::max(max_socket_descriptor, socket_descriptor);
+                if ((events[i].events & ~std::uint32_t(EPOLLOUT)) != 0u)
+                {
+                    this->receive(static_cast<std::uint32_t>(event_data));
+                }
+            }
         }
+    }
+
+    // Workers finish the messages they are handling; the latch makes sure
+    // no worker misses the notification between testing and waiting.
+    {
+        std::unique_lock _{this->_connections_latch};
+    }
+    this->_scheduled_clients_condition.notify_all();
+    this->_responses_condition.notify_all();
+    for (auto &worker : this->_workers)
+    {
+        worker.join();
+    }
+    this->_workers.clear();
 
-        select(max_socket_descriptor + 1, &socket_descriptors, nullptr, nullptr, nullptr);
+    for (const auto &[_, connection] : this->_connections)
+    {
+        ::close(connection.socket);
+    }
+    this->_connections.clear();
+    ::close(this->_epoll);
+    ::close(this->_socket);
+    ::close(this->_wake_up_pipe[0]);
+    ::close(this->_wake_up_pipe[1]);
 
-        if (FD_ISSET(this->_socket, &socket_descriptors))
+    return true;
+}
+
+void Server::stop() noexcept
+{
+    this->_is_running = false;
+    if (this->_wake_up_pipe[1] >= 0)
+    {
+        const char wake_up = 1;
+        [[maybe_unused]] const auto _ = write(this->_wake_up_pipe[1], &wake_up, sizeof(wake_up));
+    }
+}
+
+void Server::send(std::uint32_t client_id, std::string &&message)
+{
+    this->send(client_id, reinterpret_cast<const std::byte *>(message.data()), message.size());
+}
+
+void Server::send(std::uint32_t client_id, const std::byte *message, const std::size_t size)
+{
+    const auto length = frame_header_t(size);
+    const auto count_bytes = sizeof(length) + size;
+
+    std::unique_lock lock{this->_connections_latch};
+    auto &connection = this->_connections.at(client_id);
+
+    // A slow client throttles the worker instead of growing the queue; flushing,
+    // disconnecting, and stopping wake the worker up.
+    this->_responses_condition.wait(lock, [this, &connection] {
+        return connection.count_queued_response_bytes < Config::max_queued_response_size ||
+               connection.is_closing || this->_is_running == false;
+    });
+    if (connection.is_closing)
+    {
+        return;
+    }
+
+    // Responses are sent in order; behind queued responses, the message is queued as well.
+    auto count_sent_bytes = std::size_t(0u);
+    if (connection.responses.empty())
+    {
+        // Header and data are sent in one go, without copying the data.
+        std::array<iovec, 2> buffers{iovec{const_cast<frame_header_t *>(&length), sizeof(length)},
+                                     iovec{const_cast<std::byte *>(message), size}};
+        const auto written = Server::send_buffers(connection.socket, buffers.data(), buffers.size());
+        if (written.has_value() == false)
         {
-            if ((client_socket = accept(this->_socket, reinterpret_cast<sockaddr *>(&address), &address_length)) < 0)
+            return;
+        }
+        count_sent_bytes = written.value();
+    }
+
+    if (count_sent_bytes < count_bytes)
+    {
+        auto response = std::string{};
+        response.reserve(count_bytes - count_sent_bytes);
+        if (count_sent_bytes < sizeof(length))
+        {
+            response.append(reinterpret_cast<const char *>(&length) + count_sent_bytes,
+                            sizeof(length) - count_sent_bytes);
+        }
+        const auto data_offset = count_sent_bytes > sizeof(length) ? count_sent_bytes - sizeof(length) : 0u;
+        response.append(reinterpret_cast<const char *>(message) + data_offset, size - data_offset);
+        connection.count_queued_response_bytes += response.size();
+        connection.responses.emplace_back(std::move(response));
+    }
+}
+
+void Server::flush(const std::uint32_t client_id)
+{
+    {
+        std::unique_lock _{this->_connections_latch};
+        auto connection = this->_connections.find(client_id);
+        if (connection == this->_connections.end())
+        {
+            return;
+        }
+
+        auto &responses = connection->second.responses;
+        auto &count_sent_bytes = connection->second.count_sent_response_bytes;
+        auto &count_queued_bytes = connection->second.count_queued_response_bytes;
+        while (responses.empty() == false)
+        {
+            auto &response = responses.front();
+            iovec buffer{response.data() + count_sent_bytes, response.size() - count_sent_bytes};
+            const auto written = Server::send_buffers(connection->second.socket, &buffer, 1u);
+            if (written.has_value() == false)
+            {
+                // The listening thread notices the disconnect on receiving.
+                responses.clear();
+                count_sent_bytes = 0u;
+                count_queued_bytes = 0u;
+                break;
+            }
+
+            count_sent_bytes += written.value();
+            count_queued_bytes -= written.value();
+            if (count_sent_bytes < response.size())
             {
-                return false;
+                // The socket is full; the next EPOLLOUT event continues.
+                break;
             }
 
-            const auto id = this->add_client(client_socket);
-            if (id < this->_client_sockets.size())
+            responses.pop_front();
+            count_sent_bytes = 0u;
+        }
+    }
+
+    // Workers blocked on a full queue may continue.
+    this->_responses_condition.notify_all();
+}
+
+std::optional<std::size_t> Server::send_buffers(const std::int32_t socket, iovec *buffers, std::size_t count_buffers)
+{
+    msghdr message_header{};
+    message_header.msg_iov = buffers;
+    message_header.msg_iovlen = count_buffers;
+
+    auto count_written_bytes = std::size_t(0u);
+    while (message_header.msg_iovlen > 0u)
+    {
+        const auto sent = ::sendmsg(socket, &message_header, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
             {
-                this->_handler.on_client_connected(id);
+                continue;
             }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return count_written_bytes;
+            }
+            return std::nullopt;
+        }
+
+        count_written_bytes += std::size_t(sent);
+        auto remaining = std::size_t(sent);
+        while (message_header.msg_iovlen > 0u && remaining >= message_header.msg_iov->iov_len)
+        {
+            remaining -= message_header.msg_iov->iov_len;
+            ++message_header.msg_iov;
+            --message_header.msg_iovlen;
+        }
+        if (message_header.msg_iovlen > 0u)
+        {
+            message_header.msg_iov->iov_base = static_cast<std::byte *>(message_header.msg_iov->iov_base) + remaining;
+            message_header.msg_iov->iov_len -= remaining;
+        }
+    }
+
+    return count_written_bytes;
+}
+
+std::uint32_t Server::add_client(std::int32_t client_socket)
+{
+    std::unique_lock _{this->_connections_latch};
+    auto id = std::uint32_t(this->_connections.size());
+    if (this->_free_client_ids.empty() == false)
+    {
+        id = this->_free_client_ids.back();
+        this->_free_client_ids.pop_back();
+    }
+
+    this->_connections[id].socket = client_socket;
+    return id;
+}
+
+void Server::receive(const std::uint32_t client_id)
+{
+    std::int32_t client_socket;
+    std::string *received;
+    {
+        std::unique_lock _{this->_connections_latch};
+        auto connection = this->_connections.find(client_id);
+
+        // Connections closed by a worker are not read anymore.
+        if (connection == this->_connections.end() || connection->second.is_closing)
+        {
+            return;
         }
+        client_socket = connection->second.socket;
 
-        for (auto i = 0u; i < this->_client_sockets.size(); i++)
+        // The connection is only erased by the listening thread or, once closing, by a worker.
+        received = &connection->second.received;
+    }
+
+    // Edge-triggered events require to read until the socket would block.
+    while (true)
+    {
+        const auto count_bytes = recv(client_socket, this->_buffer.data(), this->_buffer.size(), MSG_DONTWAIT);
+        if (count_bytes > 0)
         {
-            const auto client = this->_client_sockets[i];
-            if (FD_ISSET(client, &socket_descriptors))
+            received->append(this->_buffer.data(), count_bytes);
+
+            // Every complete request is scheduled, a partial one waits for further bytes.
+            auto offset = std::size_t(0u);
+            while (received->size() - offset >= sizeof(frame_header_t))
             {
-                if (read(client, this->_buffer.data(), this->_buffer.size()) == 0)
+                frame_header_t length;
+                std::memcpy(&length, received->data() + offset, sizeof(length));
+                if (length == cancel_frame_header)
                 {
-                    ::close(client);
-                    this->_client_sockets[i] = 0;
-                    this->_handler.on_client_disconnected(i);
+                    // Cancels the running request, while further requests are still queued.
+                    this->_handler.on_cancel(client_id);
+                    offset += sizeof(length);
+                    continue;
                 }
-                else
+
+                if (length > Config::max_request_size)
                 {
-                    std::string message(this->_buffer.data());
-                    std::memset(this->_buffer.data(), '\0', message.length());
-                    auto response = this->_handler.handle_message(i, message);
-                    if (response.has_value())
-                    {
-                        this->send(i, std::move(response.value()));
-                    }
+                    this->disconnect(client_id);
+                    return;
+                }
+
+                if (received->size() - offset - sizeof(length) < length)
+                {
+                    break;
                 }
+
+                this->schedule(client_id, received->substr(offset + sizeof(length), length));
+                offset += sizeof(length) + length;
             }
+            received->erase(0u, offset);
+        }
+        else if (count_bytes < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            if (count_bytes == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+            {
+                this->disconnect(client_id);
+            }
+            return;
         }
     }
+}
 
-    for (const auto client : this->_client_sockets)
+void Server::schedule(const std::uint32_t client_id, std::string &&message)
+{
     {
-        if (client > 0)
+        std::unique_lock _{this->_connections_latch};
+        auto &connection = this->_connections.at(client_id);
+        connection.messages.emplace_back(std::move(message));
+        if (connection.is_scheduled)
         {
-            ::close(client);
+            return;
         }
-    }
-    ::close(this->_socket);
 
-    return true;
+        connection.is_scheduled = true;
+        this->_scheduled_clients.push_back(client_id);
+    }
+    this->_scheduled_clients_condition.notify_one();
 }
 
-void Server::send(std::uint32_t client_id, std::string &&message)
+void Server::disconnect(const std::uint32_t client_id)
 {
-    const auto length = std::uint64_t(message.size());
-    auto response = std::string(length + sizeof(length), '\0');
-
-    // Write header
-    std::memcpy(response.data(), static_cast<const void *>(&length), sizeof(length));
+    auto is_scheduled = false;
+    {
+        std::unique_lock _{this->_connections_latch};
+        auto &connection = this->_connections.at(client_id);
+        is_scheduled = connection.is_scheduled;
+        if (is_scheduled)
+        {
+            // The worker closes the connection after handling the current message.
+            connection.messages.clear();
+            connection.is_closing = true;
+        }
+    }
 
-    // Write data
-    std::memmove(response.data() + sizeof(length), message.data(), length);
+    if (is_scheduled)
+    {
+        // Nobody reads the result of the running request anymore; wakes up the worker if it waits for the client.
+        this->_handler.on_cancel(client_id);
+        this->_responses_condition.notify_all();
+        return;
+    }
 
-    ::send(this->_client_sockets[client_id], response.c_str(), response.length(), 0);
+    this->close(client_id);
 }
 
-std::uint16_t Server::add_client(std::int32_t client_socket)
+void Server::close(const std::uint32_t client_id)
 {
-    for (auto i = 0u; i < this->_client_sockets.size(); i++)
+    this->_handler.on_client_disconnected(client_id);
+
+    // Closing the socket removes it from epoll.
+    std::unique_lock _{this->_connections_latch};
+    ::close(this->_connections.at(client_id).socket);
+    this->_connections.erase(client_id);
+    this->_free_client_ids.push_back(client_id);
+}
+void Server::work()
+{
+    while (true)
     {
-        if (this->_client_sockets[i] == 0)
+        std::uint32_t client_id;
+        std::optional<std::string> message;
         {
-            this->_client_sockets[i] = client_socket;
-            return i;
+            std::unique_lock lock{this->_connections_latch};
+            this->_scheduled_clients_condition.wait(
+                lock, [this] { return this->_scheduled_clients.empty() == false || this->_is_running == false; });
+            if (this->_is_running == false)
+            {
+                return;
+            }
+
+            client_id = this->_scheduled_clients.front();
+            this->_scheduled_clients.pop_front();
+
+            // Messages of a client that disconnected meanwhile are dropped.
+            auto &connection = this->_connections.at(client_id);
+            if (connection.messages.empty() == false)
+            {
+                message = std::move(connection.messages.front());
+                connection.messages.pop_front();
+            }
+        }
+
+        if (message.has_value())
+        {
+            auto response = this->_handler.handle_message(client_id, message.value());
+            if (response.has_value())
+            {
+                this->send(client_id, std::move(response.value()));
+            }
         }
-    }
 
-    return std::numeric_limits<std::uint16_t>::max();
+        auto is_closing = false;
+        {
+            std::unique_lock _{this->_connections_latch};
+            auto &connection = this->_connections.at(client_id);
+            if (connection.messages.empty() == false)
+            {
+                // Further messages of the client queue up behind other clients.
+                this->_scheduled_clients.push_back(client_id);
+                this->_scheduled_clients_condition.notify_one();
+            }
+            else
+            {
+                connection.is_scheduled = false;
+                is_closing = connection.is_closing;
+            }
+        }
+
+        if (is_closing)
+        {
+            this->close(client_id);
+        }
+    }
 }
@@ -71,7 +71,8 @@
 %token PLUS_TK MINUS_TK DIV_TK MUL_TK CAST_TK
 %token ORDER_BY_TK ASC_TK DESC_TK
 %token LIMIT_TK OFFSET_TK
-%token BEGIN_TK ABORT_TK COMMIT_TK
+%token BEGIN_TK READ_ONLY_TK SERIALIZABLE_TK SNAPSHOT_TK ABORT_TK COMMIT_TK
+%token ANALYZE_TK
 %token END_TK
 
 %type <std::unique_ptr<NodeInterface>> query
@@ -82,6 +83,7 @@
 %type <std::unique_ptr<UpdateStatement>> update_statement
 %type <std::unique_ptr<DeleteStatement>> delete_statement
 %type <std::unique_ptr<TransactionStatement>> transaction_statement
+%type <std::unique_ptr<AnalyzeStatement>> analyze_statement
 %type <std::unique_ptr<SelectQuery>> select_query
 %type <std::pair<table::Column, expression::Term>> column_description
 %type <table::Schema> schema_description
@@ -89,6 +91,8 @@
 %type <bool> optional_if_not_exists
 %type <bool> optional_nullable
 %type <bool> optional_unique
+%type <bool> optional_read_only
+%type <TransactionStatement::IsolationLevel> optional_isolation_level
 %type <std::vector<std::string>> column_names
 %type <std::vector<std::string>> optional_column_names
 %type <std::vector<std::vector<table::Value>>> values_list
@@ -137,6 +141,7 @@ statement:
     | update_statement { $$ = std::move($1); }
     | delete_statement { $$ = std::move($1); }
     | transaction_statement { $$ = std::move($1); }
+    | analyze_statement { $$ = std::move($1); }
 
 /******************************
  * SELECT
@@ -358,8 +363,8 @@ delete_statement:
 
 /** TRANSACTION **/
 transaction_statement:
-    BEGIN_TK {
-        $$ = std::make_unique<TransactionStatement>(TransactionStatement::Type::BeginTransaction);
+    BEGIN_TK optional_read_only optional_isolation_level {
+        $$ = std::make_unique<TransactionStatement>(TransactionStatement::Type::BeginTransaction, $2, $3);
     }
     | COMMIT_TK {
         $$ = std::make_unique<TransactionStatement>(TransactionStatement::Type::CommitTransaction);
@@ -367,6 +372,24 @@ transaction_statement:
     | ABORT_TK {
         $$ = std::make_unique<TransactionStatement>(TransactionStatement::Type::AbortTransaction);
     }
+
+optional_read_only:
+    READ_ONLY_TK { $$ = true; }
+    | { $$ = false; }
+
+optional_isolation_level:
+    SERIALIZABLE_TK { $$ = TransactionStatement::IsolationLevel::Serializable; }
+    | SNAPSHOT_TK { $$ = TransactionStatement::IsolationLevel::Snapshot; }
+    | { $$ = TransactionStatement::IsolationLevel::Serializable; }
+
+/** ANALYZE **/
+analyze_statement:
+    ANALYZE_TK {
+        $$ = std::make_unique<AnalyzeStatement>(std::nullopt);
+    }
+    | ANALYZE_TK REFERENCE {
+        $$ = std::make_unique<AnalyzeStatement>(std::make_optional(std::move($2)));
+    }
 %%
 
 void beedb::parser::Parser::error(const location_type &/*type*/, const std::string& message)
@@ -75,9 +75,13 @@ OFFSET                              { return Parser::make_OFFSET_TK(loc); }
 "/"                                 { return Parser::make_DIV_TK(loc); }
 "*"                                 { return Parser::make_MUL_TK(loc); }
 BEGIN                               { return Parser::make_BEGIN_TK(loc); }
+"READ ONLY"                         { return Parser::make_READ_ONLY_TK(loc); }
+"ISOLATION LEVEL SERIALIZABLE"      { return Parser::make_SERIALIZABLE_TK(loc); }
+"ISOLATION LEVEL SNAPSHOT"          { return Parser::make_SNAPSHOT_TK(loc); }
 COMMIT                              { return Parser::make_COMMIT_TK(loc); }
 ABORT                               { return Parser::make_ABORT_TK(loc); }
 END                                 { return Parser::make_END_TK(loc); }
+ANALYZE                             { return Parser::make_ANALYZE_TK(loc); }
 \'[0-9]{4}\-[0-9]{2}\-[0-9]{2}\'    { return Parser::make_DATE(table::Date::from_string(std::string{yytext}.substr(1, std::strlen(yytext)-2)), loc); }
 \'[0-9]+\'                          { return Parser::make_STRING_INTEGER(std::stoll(std::string{yytext}.substr(1, std::strlen(yytext)-2)), loc); }
 \'[^\']+\'                          { return Parser::make_STRING(std::string{yytext}.substr(1, std::strlen(yytext)-2), loc); }
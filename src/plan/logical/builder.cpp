@@ -23,6 +23,7 @@
 #include <exception/logical_exception.h>
 #include <plan/logical/builder.h>
 #include <plan/logical/node/aggregation_node.h>
+#include <plan/logical/node/analyze_node.h>
 #include <plan/logical/node/arithmetic_node.h>
 #include <plan/logical/node/create_index_node.h>
 #include <plan/logical/node/create_table_node.h>
@@ -367,7 +368,11 @@ std::unique_ptr<NodeInterface> Builder::build(Database &, parser::TransactionSta
 {
     if (transaction_statement->is_begin())
     {
-        return std::make_unique<BeginTransactionNode>();
+        const auto isolation_level =
+            transaction_statement->isolation_level() == parser::TransactionStatement::IsolationLevel::Snapshot
+                ? concurrency::IsolationLevel::Snapshot
+                : concurrency::IsolationLevel::Serializable;
+        return std::make_unique<BeginTransactionNode>(transaction_statement->is_read_only(), isolation_level);
     }
     else if (transaction_statement->is_commit())
     {
@@ -379,6 +384,16 @@ std::unique_ptr<NodeInterface> Builder::build(Database &, parser::TransactionSta
     }
 }
 
+std::unique_ptr<NodeInterface> Builder::build(Database &database, parser::AnalyzeStatement *analyze_statement)
+{
+    auto analyze_node = std::make_unique<AnalyzeNode>(database, std::move(analyze_statement->table_name()));
+
+    TableMap tables;
+    analyze_node->check_and_emit_schema(tables);
+
+    return analyze_node;
+}
+
 std::unique_ptr<NodeInterface> Builder::build(Database &database, const std::unique_ptr<parser::NodeInterface> &query)
 {
     if (typeid(*query) == typeid(parser::SelectQuery))
@@ -416,6 +431,11 @@ std::unique_ptr<NodeInterface> Builder::build(Database &database, const std::uni
         return Builder::build(database, reinterpret_cast<parser::TransactionStatement *>(query.get()));
     }
 
+    if (typeid(*query) == typeid(parser::AnalyzeStatement))
+    {
+        return Builder::build(database, reinterpret_cast<parser::AnalyzeStatement *>(query.get()));
+    }
+
     throw exception::LogicalException("Logical plan construction not (yet) implemented for this query type.");
 }
 
@@ -0,0 +1,420 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <algorithm>
+#include <plan/logical/cardinality_estimator.h>
+#include <plan/logical/node/aggregation_node.h>
+#include <plan/logical/node/cross_product_node.h>
+#include <plan/logical/node/empty_node.h>
+#include <plan/logical/node/join_node.h>
+#include <plan/logical/node/limit_node.h>
+#include <plan/logical/node/scan_node.h>
+#include <plan/logical/node/selection_node.h>
+#include <set>
+#include <statistic/column_statistic.h>
+#include <statistic/selectivity_estimator.h>
+
+using namespace beedb::plan::logical;
+
+void CardinalityEstimator::estimate(const std::unique_ptr<NodeInterface> &plan)
+{
+    if (plan != nullptr)
+    {
+        this->estimate(plan.get(), nullptr);
+    }
+}
+
+void CardinalityEstimator::estimate(const PlanView &plan)
+{
+    auto *root = plan.root();
+    if (root != nullptr)
+    {
+        this->estimate(root, &plan);
+    }
+}
+
+void CardinalityEstimator::learn(const std::unique_ptr<NodeInterface> &plan)
+{
+    if (plan != nullptr)
+    {
+        this->learn(plan.get());
+    }
+}
+
+CardinalityEstimator::TableAliases CardinalityEstimator::estimate(NodeInterface *node, const PlanView *plan)
+{
+    auto tables = this->scanned_tables(node);
+    const auto children = CardinalityEstimator::children(node, plan);
+    std::optional<double> child_cardinality{};
+    std::optional<double> left_cardinality{};
+    std::optional<double> right_cardinality{};
+    if (node->is_unary() && children[0] != nullptr)
+    {
+        tables = this->estimate(children[0], plan);
+        child_cardinality = children[0]->estimated_cardinality();
+
+        // Index scans return all rows of the looked up pages; the selection
+        // on top evaluates the complete predicate on the scanned table.
+        if (typeid(*children[0]) == typeid(IndexScanNode))
+        {
+            child_cardinality = this->table_cardinality(children[0]);
+        }
+    }
+    else if (node->is_binary() && children[0] != nullptr && children[1] != nullptr)
+    {
+        tables = this->estimate(children[0], plan);
+        tables.merge(this->estimate(children[1], plan));
+        left_cardinality = children[0]->estimated_cardinality();
+        right_cardinality = children[1]->estimated_cardinality();
+    }
+
+    auto &feedback = this->_database.system_statistics().cardinality_feedback();
+    const auto *predicate = CardinalityEstimator::predicate(node);
+    const auto corrected_selectivity = [&]() {
+        if (predicate == nullptr || *predicate == nullptr)
+        {
+            return 1.0;
+        }
+
+        const auto selectivity = this->selectivity(*predicate, tables) *
+                                 feedback.correction(CardinalityEstimator::signature(*predicate, tables));
+        return std::clamp(selectivity, 0.0, 1.0);
+    };
+
+    if (typeid(*node) == typeid(TableScanNode))
+    {
+        node->estimated_cardinality(this->table_cardinality(node));
+    }
+    else if (typeid(*node) == typeid(IndexScanNode))
+    {
+        node->estimated_cardinality(this->table_cardinality(node) * corrected_selectivity());
+    }
+    else if (node->is_binary())
+    {
+        if (left_cardinality.has_value() && right_cardinality.has_value())
+        {
+            node->estimated_cardinality(left_cardinality.value() * right_cardinality.value() * corrected_selectivity());
+        }
+    }
+    else if (child_cardinality.has_value())
+    {
+        if (typeid(*node) == typeid(SelectionNode))
+        {
+            node->estimated_cardinality(child_cardinality.value() * corrected_selectivity());
+        }
+        else if (typeid(*node) == typeid(EmptyNode))
+        {
+            node->estimated_cardinality(0.0);
+        }
+        else if (typeid(*node) == typeid(LimitNode))
+        {
+            auto *limit_node = reinterpret_cast<LimitNode *>(node);
+            const auto remaining = std::max(0.0, child_cardinality.value() - double(limit_node->offset()));
+            node->estimated_cardinality(std::min(remaining, double(limit_node->limit())));
+        }
+        else if (typeid(*node) == typeid(AggregationNode))
+        {
+            auto *aggregation_node = reinterpret_cast<AggregationNode *>(node);
+            if (aggregation_node->group_expressions().empty())
+            {
+                node->estimated_cardinality(1.0);
+            }
+            else
+            {
+                // Every group is a combination of distinct values of the grouped columns.
+                auto count_groups = 1.0;
+                for (const auto &group : aggregation_node->group_expressions())
+                {
+                    auto distinct = child_cardinality.value();
+                    if (group.is_attribute() && group.get<expression::Attribute>().table_name().has_value())
+                    {
+                        const auto &attribute = group.get<expression::Attribute>();
+                        if (auto table = tables.find(attribute.table_name().value()); table != tables.end())
+                        {
+                            const auto &schema = table->second->schema();
+                            const auto index = schema.column_index(attribute.column_name());
+                            const auto statistic =
+                                index.has_value() ? this->_database.system_statistics().column_statistics().statistic(
+                                                        schema.column(index.value()).id())
+                                                  : std::nullopt;
+                            if (statistic.has_value())
+                            {
+                                distinct = double(statistic->count_distinct());
+                            }
+                        }
+                    }
+                    count_groups *= distinct;
+                }
+                node->estimated_cardinality(std::min(child_cardinality.value(), count_groups));
+            }
+        }
+        else
+        {
+            node->estimated_cardinality(child_cardinality.value());
+        }
+    }
+
+    return tables;
+}
+
+std::array<NodeInterface *, 2> CardinalityEstimator::children(NodeInterface *node, const PlanView *plan)
+{
+    if (plan != nullptr)
+    {
+        const auto &children = plan->nodes_and_children();
+        if (auto iterator = children.find(node); iterator != children.end())
+        {
+            return iterator->second;
+        }
+        return {nullptr, nullptr};
+    }
+
+    if (node->is_unary())
+    {
+        return {reinterpret_cast<UnaryNode *>(node)->child().get(), nullptr};
+    }
+    else if (node->is_binary())
+    {
+        auto *binary_node = reinterpret_cast<BinaryNode *>(node);
+        return {binary_node->left_child().get(), binary_node->right_child().get()};
+    }
+
+    return {nullptr, nullptr};
+}
+
+CardinalityEstimator::TableAliases CardinalityEstimator::learn(NodeInterface *node)
+{
+    auto tables = this->scanned_tables(node);
+    std::optional<double> input_cardinality{};
+    if (node->is_unary())
+    {
+        auto *child = reinterpret_cast<UnaryNode *>(node)->child().get();
+        tables = this->learn(child);
+        if (child->actual_cardinality().has_value())
+        {
+            input_cardinality = double(child->actual_cardinality().value());
+        }
+    }
+    else if (node->is_binary())
+    {
+        auto *binary_node = reinterpret_cast<BinaryNode *>(node);
+        tables = this->learn(binary_node->left_child().get());
+        tables.merge(this->learn(binary_node->right_child().get()));
+
+        const auto &left_cardinality = binary_node->left_child()->actual_cardinality();
+        const auto &right_cardinality = binary_node->right_child()->actual_cardinality();
+        if (left_cardinality.has_value() && right_cardinality.has_value())
+        {
+            input_cardinality = double(left_cardinality.value()) * double(right_cardinality.value());
+        }
+    }
+    else if (typeid(*node) == typeid(IndexScanNode))
+    {
+        // Index scans emit all rows of the looked up pages, not only the qualifying ones;
+        // learning from them would poison the feedback of the predicate.
+        return tables;
+    }
+
+    const auto *predicate = CardinalityEstimator::predicate(node);
+    if (predicate == nullptr || *predicate == nullptr || node->actual_cardinality().has_value() == false ||
+        input_cardinality.has_value() == false || input_cardinality.value() <= 0.0)
+    {
+        return tables;
+    }
+
+    const auto actual_selectivity =
+        std::min(1.0, double(node->actual_cardinality().value()) / input_cardinality.value());
+    this->_database.system_statistics().cardinality_feedback().record(
+        CardinalityEstimator::signature(*predicate, tables), this->selectivity(*predicate, tables), actual_selectivity);
+
+    return tables;
+}
+
+CardinalityEstimator::TableAliases CardinalityEstimator::scanned_tables(NodeInterface *node) const
+{
+    const TableReference *table_reference = nullptr;
+    if (typeid(*node) == typeid(TableScanNode))
+    {
+        table_reference = &reinterpret_cast<TableScanNode *>(node)->table();
+    }
+    else if (typeid(*node) == typeid(IndexScanNode))
+    {
+        table_reference = &reinterpret_cast<IndexScanNode *>(node)->table();
+    }
+
+    TableAliases tables;
+    if (table_reference != nullptr && this->_database.table_exists(table_reference->table_name()))
+    {
+        auto *table = this->_database.table(table_reference->table_name());
+        tables.insert(std::make_pair(table_reference->table_alias(), table));
+        tables.insert(std::make_pair(table_reference->table_name(), table));
+    }
+
+    return tables;
+}
+
+const std::unique_ptr<beedb::expression::Operation> *CardinalityEstimator::predicate(NodeInterface *node)
+{
+    if (typeid(*node) == typeid(SelectionNode))
+    {
+        return &reinterpret_cast<SelectionNode *>(node)->predicate();
+    }
+    else if (typeid(*node) == typeid(IndexScanNode))
+    {
+        return &reinterpret_cast<IndexScanNode *>(node)->predicate();
+    }
+    else if (typeid(*node) == typeid(NestedLoopsJoinNode) || typeid(*node) == typeid(HashJoinNode))
+    {
+        return &reinterpret_cast<AbstractJoinNode *>(node)->predicate();
+    }
+
+    return nullptr;
+}
+
+double CardinalityEstimator::table_cardinality(NodeInterface *node) const
+{
+    const auto tables = this->scanned_tables(node);
+    if (tables.empty())
+    {
+        return 0.0;
+    }
+
+    return double(this->_database.system_statistics().table_statistics().cardinality(*tables.begin()->second));
+}
+
+double CardinalityEstimator::selectivity(const std::unique_ptr<expression::Operation> &predicate,
+                                         const TableAliases &tables) const
+{
+    if (predicate == nullptr)
+    {
+        return 1.0;
+    }
+
+    if (predicate->is_logical_connective())
+    {
+        auto *binary_operation = reinterpret_cast<expression::BinaryOperation *>(predicate.get());
+        const auto left = this->selectivity(binary_operation->left_child(), tables);
+        const auto right = this->selectivity(binary_operation->right_child(), tables);
+
+        if (predicate->type() == expression::Operation::Type::And)
+        {
+            return left * right;
+        }
+
+        return left + right - left * right;
+    }
+
+    if (predicate->is_comparison() == false)
+    {
+        return 1.0;
+    }
+
+    // Resolve the tables referenced by the comparison.
+    std::vector<std::pair<const expression::Attribute *, table::Table *>> referenced_columns;
+    const auto attributes = expression::attributes(predicate);
+    std::set<table::Table *> referenced_tables;
+    for (const auto &attribute : attributes)
+    {
+        if (attribute.table_name().has_value())
+        {
+            if (auto table = tables.find(attribute.table_name().value()); table != tables.end())
+            {
+                referenced_columns.emplace_back(&attribute, table->second);
+                referenced_tables.insert(table->second);
+            }
+        }
+    }
+
+    if (referenced_tables.size() == 1u && referenced_columns.size() == attributes.size())
+    {
+        const auto &[attribute, table] = referenced_columns.front();
+        return statistic::SelectivityEstimator{this->_database.system_statistics(), *table,
+                                               attribute->table_name().value()}
+            .estimate(predicate);
+    }
+
+    // Equi-join of two columns (attribute = attribute).
+    if (predicate->type() == expression::Operation::Type::Equals && referenced_columns.size() == 2u)
+    {
+        std::uint64_t distinct = 1u;
+        for (const auto &[attribute, table] : referenced_columns)
+        {
+            const auto index = table->schema().column_index(attribute->column_name());
+            const auto statistic =
+                index.has_value() ? this->_database.system_statistics().column_statistics().statistic(
+                                        table->schema().column(index.value()).id())
+                                  : std::nullopt;
+            if (statistic.has_value() == false)
+            {
+                return statistic::ColumnStatistic::default_equals_selectivity;
+            }
+            distinct = std::max(distinct, statistic->count_distinct());
+        }
+
+        return 1.0 / double(distinct);
+    }
+
+    return predicate->type() == expression::Operation::Type::Equals
+               ? statistic::ColumnStatistic::default_equals_selectivity
+               : statistic::ColumnStatistic::default_range_selectivity;
+}
+
+std::string CardinalityEstimator::signature(const std::unique_ptr<expression::Operation> &predicate,
+                                            const TableAliases &tables)
+{
+    if (predicate == nullptr)
+    {
+        return "";
+    }
+
+    if (predicate->is_nullary())
+    {
+        const auto &term = reinterpret_cast<expression::NullaryOperation *>(predicate.get())->term();
+        if (term.is_attribute())
+        {
+            const auto &attribute = term.get<expression::Attribute>();
+            if (attribute.table_name().has_value())
+            {
+                auto table = tables.find(attribute.table_name().value());
+                return (table != tables.end() ? table->second->name() : attribute.table_name().value()) + "." +
+                       attribute.column_name();
+            }
+
+            return attribute.column_name();
+        }
+
+        return static_cast<std::string>(term);
+    }
+
+    const auto type = std::to_string(static_cast<std::int32_t>(predicate->type()));
+    if (predicate->is_unary())
+    {
+        return type + "(" +
+               CardinalityEstimator::signature(
+                   reinterpret_cast<expression::UnaryOperation *>(predicate.get())->child(), tables) +
+               ")";
+    }
+
+    auto *binary_operation = reinterpret_cast<expression::BinaryOperation *>(predicate.get());
+    return "(" + CardinalityEstimator::signature(binary_operation->left_child(), tables) + " " + type + " " +
+           CardinalityEstimator::signature(binary_operation->right_child(), tables) + ")";
+}
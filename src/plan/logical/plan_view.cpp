@@ -129,6 +129,22 @@ void PlanView::insert_between(node_t first, node_t second, node_t node_to_insert
     }
 }
 
+void PlanView::insert_above(node_t node, node_t node_to_insert)
+{
+    auto *parent = this->parent(node);
+    if (parent != nullptr)
+    {
+        this->insert_between(parent, node, node_to_insert);
+    }
+    else if (node_to_insert->is_unary())
+    {
+        // The inserted node is the new root.
+        this->_node_parent[node_to_insert] = nullptr;
+        this->_node_children[node_to_insert] = {node, nullptr};
+        this->_node_parent[node] = node_to_insert;
+    }
+}
+
 void PlanView::erase(node_t node)
 {
     auto *node_to_move_parent = this->_node_parent[node];
@@ -147,7 +163,16 @@ void PlanView::erase(node_t node)
     // The parent of node has new children.
     if (node_to_move_parent != nullptr)
     {
-        this->_node_children[node_to_move_parent] = node_to_move_children;
+        auto &parent_children = this->_node_children[node_to_move_parent];
+        if (node->is_unary() && parent_children[1] != nullptr)
+        {
+            // Keep the sibling when the parent is binary.
+            std::replace(parent_children.begin(), parent_children.end(), node, node_to_move_children[0]);
+        }
+        else
+        {
+            parent_children = node_to_move_children;
+        }
     }
     this->_node_children.erase(node);
     this->_node_parent.erase(node);
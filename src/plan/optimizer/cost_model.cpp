@@ -0,0 +1,130 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <cmath>
+#include <plan/logical/node/empty_node.h>
+#include <plan/logical/node/aggregation_node.h>
+#include <plan/logical/node/join_node.h>
+#include <plan/logical/node/limit_node.h>
+#include <plan/logical/node/order_by_node.h>
+#include <plan/logical/node/scan_node.h>
+#include <plan/optimizer/cost_model.h>
+
+using namespace beedb::plan::logical;
+
+double CostModel::cost(const PlanView &plan)
+{
+    auto *root = plan.root();
+    if (root == nullptr)
+    {
+        return 0.0;
+    }
+
+    this->_cardinality_estimator.estimate(plan);
+    return CostModel::cost(plan, root);
+}
+
+double CostModel::cost(const PlanView &plan, NodeInterface *node)
+{
+    const auto rows = [](NodeInterface *child) {
+        return child != nullptr ? child->estimated_cardinality().value_or(0.0) : 0.0;
+    };
+
+    if (typeid(*node) == typeid(TableScanNode))
+    {
+        return rows(node) * CostModel::sequential_row_cost;
+    }
+    else if (typeid(*node) == typeid(IndexScanNode))
+    {
+        return rows(node) * CostModel::index_row_cost;
+    }
+
+    const auto &children = plan.nodes_and_children();
+    const auto iterator = children.find(node);
+    if (iterator == children.end())
+    {
+        return 0.0;
+    }
+
+    auto *left = std::get<0>(iterator->second);
+    auto *right = std::get<1>(iterator->second);
+    if (node->is_binary() && left != nullptr && right != nullptr)
+    {
+        const auto children_cost = CostModel::cost(plan, left) + CostModel::cost(plan, right);
+        if (typeid(*node) == typeid(HashJoinNode))
+        {
+            return children_cost + (rows(left) + rows(right)) * CostModel::hash_row_cost;
+        }
+
+        // Nested loops joins and cross products touch every pair of rows.
+        return children_cost + rows(left) * rows(right) * CostModel::cpu_row_cost;
+    }
+    else if (left != nullptr)
+    {
+        const auto child_cost = CostModel::cost(plan, left);
+        if (typeid(*node) == typeid(EmptyNode))
+        {
+            // The child will never be executed.
+            return 0.0;
+        }
+        else if (typeid(*node) == typeid(LimitNode) && CostModel::is_pipelined(plan, left))
+        {
+            // Without blocking operators below, the child stops after producing the needed rows.
+            auto *limit_node = reinterpret_cast<LimitNode *>(node);
+            const auto needed_rows = double(limit_node->offset()) + double(limit_node->limit());
+            const auto fraction = std::min(1.0, needed_rows / std::max(rows(left), 1.0));
+            return child_cost * fraction + std::min(rows(left), needed_rows) * CostModel::cpu_row_cost;
+        }
+        else if (typeid(*node) == typeid(OrderByNode))
+        {
+            const auto count_rows = std::max(rows(left), 1.0);
+            return child_cost + count_rows * std::log2(count_rows + 1.0) * CostModel::cpu_row_cost;
+        }
+
+        return child_cost + rows(left) * CostModel::cpu_row_cost;
+    }
+
+    return 0.0;
+}
+
+bool CostModel::is_pipelined(const PlanView &plan, NodeInterface *node)
+{
+    if (typeid(*node) == typeid(OrderByNode) || typeid(*node) == typeid(AggregationNode) ||
+        typeid(*node) == typeid(HashJoinNode))
+    {
+        return false;
+    }
+
+    const auto &children = plan.nodes_and_children();
+    if (auto iterator = children.find(node); iterator != children.end())
+    {
+        for (auto *child : iterator->second)
+        {
+            if (child != nullptr && CostModel::is_pipelined(plan, child) == false)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
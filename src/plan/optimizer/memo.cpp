@@ -0,0 +1,191 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <plan/logical/node/empty_node.h>
+#include <plan/logical/node/join_node.h>
+#include <plan/logical/node/scan_node.h>
+#include <plan/logical/node/selection_node.h>
+#include <plan/optimizer/memo.h>
+#include <sstream>
+
+using namespace beedb::plan::logical;
+
+Memo::Memo(CostModel &cost_model, const std::size_t capacity, const PlanView &plan)
+    : _cost_model(cost_model), _capacity(capacity)
+{
+    for (const auto &[node, _] : plan.nodes_and_parent())
+    {
+        this->_plan_nodes.insert(node);
+    }
+
+    auto initial_plan = plan;
+    this->_fingerprints.insert(Memo::fingerprint(initial_plan, initial_plan.root()));
+    const auto cost = this->_cost_model.cost(initial_plan);
+    this->_alternatives.emplace_back(std::move(initial_plan), cost);
+}
+
+bool Memo::insert(PlanView &&plan)
+{
+    this->adopt_nodes(plan);
+
+    if (this->_alternatives.size() >= this->_capacity)
+    {
+        return false;
+    }
+
+    auto fingerprint = Memo::fingerprint(plan, plan.root());
+    if (this->_fingerprints.find(fingerprint) != this->_fingerprints.end())
+    {
+        return false;
+    }
+    this->_fingerprints.insert(std::move(fingerprint));
+
+    const auto cost = this->_cost_model.cost(plan);
+    this->_alternatives.emplace_back(std::move(plan), cost);
+    if (cost < this->_alternatives[this->_best_index].cost)
+    {
+        this->_best_index = this->_alternatives.size() - 1u;
+    }
+
+    return true;
+}
+
+std::optional<PlanView> Memo::next()
+{
+    const auto cost_bound = this->_alternatives[this->_best_index].cost * Memo::prune_factor;
+
+    Alternative *cheapest = nullptr;
+    for (auto &alternative : this->_alternatives)
+    {
+        if (alternative.is_explored == false && alternative.cost <= cost_bound &&
+            (cheapest == nullptr || alternative.cost < cheapest->cost))
+        {
+            cheapest = &alternative;
+        }
+    }
+
+    if (cheapest == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    cheapest->is_explored = true;
+    return std::make_optional(cheapest->plan);
+}
+
+PlanView Memo::release_best()
+{
+    auto &best = this->_alternatives[this->_best_index].plan;
+    for (const auto &[node, _] : best.nodes_and_parent())
+    {
+        if (auto iterator = this->_created_nodes.find(node); iterator != this->_created_nodes.end())
+        {
+            [[maybe_unused]] auto *released = iterator->second.release();
+            this->_created_nodes.erase(iterator);
+        }
+    }
+
+    return best;
+}
+
+void Memo::adopt_nodes(const PlanView &plan)
+{
+    for (const auto &[node, _] : plan.nodes_and_parent())
+    {
+        if (this->_plan_nodes.find(node) == this->_plan_nodes.end() &&
+            this->_created_nodes.find(node) == this->_created_nodes.end())
+        {
+            this->_created_nodes.insert(std::make_pair(node, std::unique_ptr<NodeInterface>{node}));
+        }
+    }
+}
+
+std::string Memo::fingerprint(const PlanView &plan, PlanView::node_t node)
+{
+    if (node == nullptr)
+    {
+        return "";
+    }
+
+    std::stringstream fingerprint;
+    fingerprint << node->name() << '[';
+
+    // Nodes created by rules are compared by content, all others are shared between alternatives.
+    if (typeid(*node) == typeid(SelectionNode))
+    {
+        fingerprint << Memo::fingerprint(reinterpret_cast<SelectionNode *>(node)->predicate());
+    }
+    else if (typeid(*node) == typeid(NestedLoopsJoinNode) || typeid(*node) == typeid(HashJoinNode))
+    {
+        fingerprint << Memo::fingerprint(reinterpret_cast<AbstractJoinNode *>(node)->predicate());
+    }
+    else if (typeid(*node) == typeid(TableScanNode))
+    {
+        fingerprint << reinterpret_cast<TableScanNode *>(node)->table().table_alias();
+    }
+    else if (typeid(*node) == typeid(IndexScanNode))
+    {
+        auto *index_scan_node = reinterpret_cast<IndexScanNode *>(node);
+        fingerprint << index_scan_node->table().table_alias() << ':'
+                    << Memo::fingerprint(index_scan_node->predicate());
+        if (index_scan_node->order().has_value())
+        {
+            fingerprint << ':' << static_cast<std::string>(index_scan_node->order().value());
+        }
+    }
+    else if (typeid(*node) != typeid(EmptyNode))
+    {
+        fingerprint << std::uintptr_t(node);
+    }
+    fingerprint << ']';
+
+    const auto &children = plan.nodes_and_children();
+    if (auto iterator = children.find(node); iterator != children.end())
+    {
+        fingerprint << '(' << Memo::fingerprint(plan, std::get<0>(iterator->second)) << ','
+                    << Memo::fingerprint(plan, std::get<1>(iterator->second)) << ')';
+    }
+
+    return fingerprint.str();
+}
+
+std::string Memo::fingerprint(const std::unique_ptr<expression::Operation> &operation)
+{
+    if (operation == nullptr)
+    {
+        return "";
+    }
+
+    if (operation->is_nullary())
+    {
+        return static_cast<std::string>(reinterpret_cast<expression::NullaryOperation *>(operation.get())->term());
+    }
+    else if (operation->is_unary())
+    {
+        return std::to_string(std::int32_t(operation->type())) + '(' +
+               Memo::fingerprint(reinterpret_cast<expression::UnaryOperation *>(operation.get())->child()) + ')';
+    }
+
+    auto *binary = reinterpret_cast<expression::BinaryOperation *>(operation.get());
+    return '(' + Memo::fingerprint(binary->left_child()) + ' ' + std::to_string(std::int32_t(binary->type())) + ' ' +
+           Memo::fingerprint(binary->right_child()) + ')';
+}
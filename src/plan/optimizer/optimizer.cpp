@@ -20,12 +20,15 @@
  *------------------------------------------------------------------------------*
  */
 
+#include <plan/optimizer/memo.h>
 #include <plan/optimizer/optimizer.h>
 #include <plan/optimizer/rule/cross_product_optimization_rule.h>
 #include <plan/optimizer/rule/hash_join_optimization_rule.h>
 #include <plan/optimizer/rule/index_scan_optimization_rule.h>
+#include <plan/optimizer/rule/interesting_order_optimization_rule.h>
 #include <plan/optimizer/rule/merge_selection_optimization_rule.h>
 #include <plan/optimizer/rule/predicate_push_down_optimization_rule.h>
+#include <plan/optimizer/rule/predicate_simplification_optimization_rule.h>
 #include <plan/optimizer/rule/remove_projection_optimization_rule.h>
 #include <plan/optimizer/rule/swap_operands_optimization_rule.h>
 
@@ -47,6 +50,11 @@ std::unique_ptr<NodeInterface> Optimizer::optimize(std::unique_ptr<NodeInterface
         } while (optimized_);
     }
 
+    if (this->_transformations.empty() == false && this->_cost_model != nullptr)
+    {
+        optimized |= this->explore(plan_view);
+    }
+
     if (optimized)
     {
         auto optimized_plan = Optimizer::commit(std::move(plan_view), std::move(unoptimized_plan));
@@ -62,6 +70,31 @@ std::unique_ptr<NodeInterface> Optimizer::optimize(std::unique_ptr<NodeInterface
     }
 }
 
+bool Optimizer::explore(PlanView &plan_view)
+{
+    auto memo = Memo{*this->_cost_model, Config::optimizer_memo_capacity, plan_view};
+
+    while (auto alternative = memo.next())
+    {
+        for (auto &transformation : this->_transformations)
+        {
+            auto transformed = alternative.value();
+            if (transformation->optimize(transformed))
+            {
+                memo.insert(std::move(transformed));
+            }
+        }
+    }
+
+    if (memo.has_improved())
+    {
+        plan_view = memo.release_best();
+        return true;
+    }
+
+    return false;
+}
+
 std::unique_ptr<NodeInterface> Optimizer::commit(PlanView &&plan_view, std::unique_ptr<NodeInterface> &&plan)
 {
     auto stolen_nodes = std::unordered_map<std::uintptr_t, std::unique_ptr<NodeInterface>>{};
@@ -131,17 +164,10 @@ RequiredOptimizer::RequiredOptimizer(Database &)
 
 CompleteOptimizer::CompleteOptimizer(Database &database)
 {
-    this->add(std::make_unique<CrossProductOptimizationRule>());
-
-    if (database.config()[Config::k_OptimizationEnableIndexScan])
-    {
-        this->add(std::make_unique<IndexScanOptimizationRule>(database));
-    }
+    this->cost_model(std::make_unique<CostModel>(database));
 
-    if (database.config()[Config::k_OptimizationEnableHashJoin])
-    {
-        this->add(std::make_unique<HashJoinOptimizationRule>());
-    }
+    // Normalizations are always applied, also when the costs can not tell (e.g., without statistics).
+    this->add(std::make_unique<CrossProductOptimizationRule>());
 
     if (database.config()[Config::k_OptimizationEnablePredicatePushDown])
     {
@@ -150,5 +176,19 @@ CompleteOptimizer::CompleteOptimizer(Database &database)
 
     this->add(std::make_unique<MergeSelectionOptimizationRule>());
 
+    this->add(std::make_unique<PredicateSimplificationOptimizationRule>());
+
     this->add(std::make_unique<RemoveProjectionOptimizationRule>());
-}
\ No newline at end of file
+
+    // Alternatives are chosen by their costs.
+    if (database.config()[Config::k_OptimizationEnableIndexScan])
+    {
+        this->add_transformation(std::make_unique<IndexScanOptimizationRule>(database));
+        this->add_transformation(std::make_unique<InterestingOrderOptimizationRule>(database));
+    }
+
+    if (database.config()[Config::k_OptimizationEnableHashJoin])
+    {
+        this->add_transformation(std::make_unique<HashJoinOptimizationRule>());
+    }
+}
@@ -0,0 +1,85 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <plan/logical/node/arithmetic_node.h>
+#include <plan/logical/node/empty_node.h>
+#include <plan/logical/node/limit_node.h>
+#include <plan/logical/node/order_by_node.h>
+#include <plan/logical/node/projection_node.h>
+#include <plan/logical/node/scan_node.h>
+#include <plan/logical/node/selection_node.h>
+#include <plan/optimizer/physical_properties.h>
+
+using namespace beedb::plan::logical;
+
+std::optional<beedb::expression::Attribute> PhysicalProperties::order(const PlanView &plan, PlanView::node_t node)
+{
+    if (node == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    if (typeid(*node) == typeid(IndexScanNode))
+    {
+        return reinterpret_cast<IndexScanNode *>(node)->order();
+    }
+    else if (typeid(*node) == typeid(OrderByNode))
+    {
+        return PhysicalProperties::required_order(node);
+    }
+    else if (PhysicalProperties::preserves_order(node) && plan.has_child(node))
+    {
+        return PhysicalProperties::order(plan, plan.children(node)[0]);
+    }
+
+    return std::nullopt;
+}
+
+bool PhysicalProperties::preserves_order(PlanView::node_t node)
+{
+    return typeid(*node) == typeid(SelectionNode) || typeid(*node) == typeid(ProjectionNode) ||
+           typeid(*node) == typeid(ArithmeticNode) || typeid(*node) == typeid(LimitNode) ||
+           typeid(*node) == typeid(EmptyNode);
+}
+
+std::optional<beedb::expression::Attribute> PhysicalProperties::required_order(PlanView::node_t node)
+{
+    if (typeid(*node) != typeid(OrderByNode))
+    {
+        return std::nullopt;
+    }
+
+    // Only a single ascending attribute can be served by a range index.
+    const auto &predicates = reinterpret_cast<OrderByNode *>(node)->predicates();
+    if (predicates.size() != 1u || std::get<1>(predicates.front()) == false)
+    {
+        return std::nullopt;
+    }
+
+    const auto &operation = std::get<0>(predicates.front());
+    if (operation->is_nullary() && operation->result().has_value() && operation->result()->is_attribute())
+    {
+        return std::make_optional(operation->result()->get<expression::Attribute>());
+    }
+
+    return std::nullopt;
+}
@@ -36,12 +36,11 @@ bool IndexScanOptimizationRule::optimize(PlanView &plan)
             auto *table_scan_node = reinterpret_cast<TableScanNode *>(node);
             const auto &table_name = table_scan_node->table().table_name();
             const auto &selection_predicate = reinterpret_cast<SelectionNode *>(parent)->predicate();
-            auto attribute_and_predicate = this->find_index_predicate(table_name, selection_predicate);
-            if (std::get<0>(attribute_and_predicate).has_value())
+            auto index_predicate = this->find_index_predicate(table_name, selection_predicate);
+            if (index_predicate != nullptr)
             {
                 auto *index_scan_node = new IndexScanNode(this->_database, TableReference{table_scan_node->table()},
-                                                          std::move(std::get<0>(attribute_and_predicate).value()),
-                                                          std::move(std::get<1>(attribute_and_predicate)));
+                                                          std::move(index_predicate));
                 index_scan_node->schema(table_scan_node->schema());
                 plan.replace(node, index_scan_node);
                 return true;
@@ -52,29 +51,29 @@ bool IndexScanOptimizationRule::optimize(PlanView &plan)
     return false;
 }
 
-std::pair<std::optional<beedb::expression::Attribute>, std::unique_ptr<beedb::expression::Operation>>
-IndexScanOptimizationRule::find_index_predicate(const std::string &table_name,
-                                                const std::unique_ptr<expression::Operation> &predicate)
+std::unique_ptr<beedb::expression::Operation> IndexScanOptimizationRule::find_index_predicate(
+    const std::string &table_name, const std::unique_ptr<expression::Operation> &predicate)
 {
-    if (predicate->is_logical_connective() && predicate->type() == expression::Operation::Type::And)
+    if (predicate->is_logical_connective())
     {
         auto *binary = reinterpret_cast<expression::BinaryOperation *>(predicate.get());
         auto left_predicate = this->find_index_predicate(table_name, binary->left_child());
         auto right_predicate = this->find_index_predicate(table_name, binary->right_child());
-        if (std::get<1>(left_predicate) != nullptr && std::get<1>(right_predicate) != nullptr)
+        if (left_predicate != nullptr && right_predicate != nullptr)
         {
-            return std::make_pair(
-                std::move(std::get<0>(left_predicate)),
-                std::make_unique<expression::BinaryOperation>(binary->type(), std::move(std::get<1>(left_predicate)),
-                                                              std::move(std::get<1>(right_predicate))));
-        }
-        else if (std::get<1>(left_predicate) != nullptr)
-        {
-            return left_predicate;
+            if (binary->type() == expression::Operation::Type::And)
+            {
+                return expression::BinaryOperation::make_and(std::move(left_predicate), std::move(right_predicate));
+            }
+            return expression::BinaryOperation::make_or(std::move(left_predicate), std::move(right_predicate));
         }
-        else if (std::get<1>(right_predicate) != nullptr)
+
+        // A conjunction is indexable when at least one side is, the other side
+        // is evaluated by the selection on top of the scan. A disjunction
+        // needs both sides, otherwise every page has to be scanned anyway.
+        if (binary->type() == expression::Operation::Type::And)
         {
-            return right_predicate;
+            return left_predicate != nullptr ? std::move(left_predicate) : std::move(right_predicate);
         }
     }
     else if (predicate->is_comparison() && predicate->type() != expression::Operation::Type::NotEquals)
@@ -84,10 +83,28 @@ IndexScanOptimizationRule::find_index_predicate(const std::string &table_name,
         {
             auto *left = reinterpret_cast<expression::NullaryOperation *>(binary->left_child().get());
             auto *right = reinterpret_cast<expression::NullaryOperation *>(binary->right_child().get());
+
+            const expression::Term *attribute_term = nullptr;
+            const expression::Term *value_term = nullptr;
             if (left->term().is_attribute() && right->term().is_value())
+            {
+                attribute_term = &left->term();
+                value_term = &right->term();
+            }
+            else if (left->term().is_value() && right->term().is_attribute())
+            {
+                attribute_term = &right->term();
+                value_term = &left->term();
+            }
+
+            // Indices are keyed by integers; other values (e.g. id < 2.5) are not looked up.
+            const auto is_integer_value = value_term != nullptr &&
+                                          (std::holds_alternative<std::int64_t>(value_term->attribute_or_value()) ||
+                                           std::holds_alternative<std::int32_t>(value_term->attribute_or_value()));
+            if (attribute_term != nullptr && is_integer_value)
             {
                 auto *table = this->_database.table(table_name);
-                const auto &attribute = left->term().get<expression::Attribute>();
+                const auto &attribute = attribute_term->get<expression::Attribute>();
                 const auto column_index = table->schema().column_index(attribute.column_name());
                 if (column_index.has_value())
                 {
@@ -95,15 +112,15 @@ IndexScanOptimizationRule::find_index_predicate(const std::string &table_name,
                     const auto is_range = binary->type() == expression::Operation::Type::LesserEquals ||
                                           binary->type() == expression::Operation::Type::Lesser ||
                                           binary->type() == expression::Operation::Type::Greater ||
-                                          binary->type() == expression::Operation::Type::Greater;
+                                          binary->type() == expression::Operation::Type::GreaterEquals;
                     if (column.is_indexed(is_range))
                     {
-                        return std::make_pair(std::make_optional(attribute), binary->copy());
+                        return binary->copy();
                     }
                 }
             }
         }
     }
 
-    return std::make_pair(std::nullopt, nullptr);
-}
\ No newline at end of file
+    return nullptr;
+}
@@ -0,0 +1,146 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <plan/logical/node/order_by_node.h>
+#include <plan/logical/node/scan_node.h>
+#include <plan/optimizer/physical_properties.h>
+#include <plan/optimizer/rule/interesting_order_optimization_rule.h>
+
+using namespace beedb::plan::logical;
+
+bool InterestingOrderOptimizationRule::optimize(PlanView &plan)
+{
+    for (auto [node, _] : plan.nodes_and_parent())
+    {
+        if (typeid(*node) != typeid(OrderByNode) || plan.has_child(node) == false)
+        {
+            continue;
+        }
+
+        const auto order = PhysicalProperties::required_order(node);
+        if (order.has_value() == false)
+        {
+            continue;
+        }
+
+        auto *child = plan.children(node)[0];
+        if (PhysicalProperties::order(plan, child) == order)
+        {
+            plan.erase(node);
+            return true;
+        }
+
+        // Find the scan feeding the ORDER BY through nodes keeping the order.
+        auto *scan = child;
+        while (scan != nullptr && PhysicalProperties::preserves_order(scan) && plan.has_child(scan))
+        {
+            scan = plan.children(scan)[0];
+        }
+
+        if (scan != nullptr)
+        {
+            auto *ordered_scan = this->build_ordered_scan(scan, order.value());
+            if (ordered_scan != nullptr)
+            {
+                plan.replace(scan, ordered_scan);
+                plan.erase(node);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+NodeInterface *InterestingOrderOptimizationRule::build_ordered_scan(PlanView::node_t scan,
+                                                                    const expression::Attribute &order)
+{
+    const TableReference *table_reference = nullptr;
+    const std::unique_ptr<expression::Operation> *predicate = nullptr;
+    if (typeid(*scan) == typeid(TableScanNode))
+    {
+        table_reference = &reinterpret_cast<TableScanNode *>(scan)->table();
+    }
+    else if (typeid(*scan) == typeid(IndexScanNode) &&
+             reinterpret_cast<IndexScanNode *>(scan)->order().has_value() == false)
+    {
+        table_reference = &reinterpret_cast<IndexScanNode *>(scan)->table();
+        predicate = &reinterpret_cast<IndexScanNode *>(scan)->predicate();
+    }
+
+    if (table_reference == nullptr || order.table_name() != table_reference->table_alias() ||
+        this->_database.table_exists(table_reference->table_name()) == false)
+    {
+        return nullptr;
+    }
+
+    const auto &schema = this->_database.table(table_reference->table_name())->schema();
+    const auto column_index = schema.column_index(order.column_name());
+    if (column_index.has_value() == false || schema.column(column_index.value()).is_indexed(true) == false)
+    {
+        return nullptr;
+    }
+
+    auto *ordered_scan = new IndexScanNode(
+        this->_database, TableReference{*table_reference}, expression::Attribute{order},
+        predicate != nullptr ? InterestingOrderOptimizationRule::range_predicate(*predicate, order) : nullptr);
+    ordered_scan->schema(scan->schema());
+    return ordered_scan;
+}
+
+std::unique_ptr<beedb::expression::Operation> InterestingOrderOptimizationRule::range_predicate(
+    const std::unique_ptr<expression::Operation> &predicate, const expression::Attribute &order)
+{
+    if (predicate == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (predicate->type() == expression::Operation::Type::And)
+    {
+        auto *binary = reinterpret_cast<expression::BinaryOperation *>(predicate.get());
+        auto left = InterestingOrderOptimizationRule::range_predicate(binary->left_child(), order);
+        auto right = InterestingOrderOptimizationRule::range_predicate(binary->right_child(), order);
+        if (left != nullptr && right != nullptr)
+        {
+            return expression::BinaryOperation::make_and(std::move(left), std::move(right));
+        }
+
+        return left != nullptr ? std::move(left) : std::move(right);
+    }
+    else if (predicate->is_comparison() && predicate->type() != expression::Operation::Type::NotEquals)
+    {
+        auto *binary = reinterpret_cast<expression::BinaryOperation *>(predicate.get());
+        if (binary->left_child()->is_nullary() && binary->right_child()->is_nullary())
+        {
+            const auto &left = reinterpret_cast<expression::NullaryOperation *>(binary->left_child().get())->term();
+            const auto &right = reinterpret_cast<expression::NullaryOperation *>(binary->right_child().get())->term();
+            if ((left.is_attribute() && left.get<expression::Attribute>() == order && right.is_value()) ||
+                (right.is_attribute() && right.get<expression::Attribute>() == order && left.is_value()))
+            {
+                return predicate->copy();
+            }
+        }
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,659 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <plan/logical/node/aggregation_node.h>
+#include <plan/logical/node/empty_node.h>
+#include <plan/logical/node/selection_node.h>
+#include <plan/optimizer/rule/predicate_simplification_optimization_rule.h>
+#include <string>
+
+using namespace beedb::plan::logical;
+
+bool PredicateSimplificationOptimizationRule::optimize(PlanView &plan)
+{
+    for (auto [node, _] : plan.nodes_and_parent())
+    {
+        if (typeid(*node) != typeid(SelectionNode) ||
+            PredicateSimplificationOptimizationRule::is_below_empty_result(plan, node))
+        {
+            continue;
+        }
+
+        auto *selection_node = reinterpret_cast<SelectionNode *>(node);
+        auto is_simplified = false;
+        auto simplified = PredicateSimplificationOptimizationRule::simplify(selection_node->predicate(), is_simplified);
+
+        if (std::holds_alternative<bool>(simplified))
+        {
+            if (std::get<bool>(simplified))
+            {
+                // The selection is always true.
+                plan.erase(node);
+            }
+            else
+            {
+                // The selection is never true: Nothing up to the next aggregation
+                // (that produces a row even for empty input) has to be executed.
+                auto *top = node;
+                for (auto *parent = plan.parent(top); parent != nullptr && typeid(*parent) != typeid(AggregationNode);
+                     parent = plan.parent(top))
+                {
+                    top = parent;
+                }
+                plan.insert_above(top, new EmptyNode());
+            }
+
+            return true;
+        }
+
+        if (is_simplified)
+        {
+            auto &simplified_predicate = std::get<std::unique_ptr<expression::Operation>>(simplified);
+            auto *new_selection = new SelectionNode(*selection_node, std::move(simplified_predicate));
+            plan.replace(node, new_selection);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+PredicateSimplificationOptimizationRule::SimplifiedPredicate PredicateSimplificationOptimizationRule::simplify(
+    const std::unique_ptr<expression::Operation> &predicate, bool &is_simplified)
+{
+    if (predicate->type() == expression::Operation::Type::And)
+    {
+        // Flatten the conjunction.
+        std::vector<const std::unique_ptr<expression::Operation> *> parts;
+        std::vector<const std::unique_ptr<expression::Operation> *> stack{&predicate};
+        while (stack.empty() == false)
+        {
+            const auto *operation = stack.back();
+            stack.pop_back();
+            if ((*operation)->type() == expression::Operation::Type::And)
+            {
+                const auto *binary = reinterpret_cast<const expression::BinaryOperation *>(operation->get());
+                stack.push_back(&binary->right_child());
+                stack.push_back(&binary->left_child());
+            }
+            else
+            {
+                parts.push_back(operation);
+            }
+        }
+
+        auto is_conjunction_simplified = false;
+        std::vector<std::unique_ptr<expression::Operation>> conjuncts;
+        conjuncts.reserve(parts.size());
+        for (const auto *part : parts)
+        {
+            auto simplified = PredicateSimplificationOptimizationRule::simplify(*part, is_conjunction_simplified);
+            if (std::holds_alternative<bool>(simplified))
+            {
+                is_conjunction_simplified = true;
+                if (std::get<bool>(simplified) == false)
+                {
+                    is_simplified = true;
+                    return false;
+                }
+            }
+            else
+            {
+                conjuncts.emplace_back(std::move(std::get<std::unique_ptr<expression::Operation>>(simplified)));
+            }
+        }
+
+        auto merged_conjuncts =
+            PredicateSimplificationOptimizationRule::merge_ranges(std::move(conjuncts), is_conjunction_simplified);
+        if (merged_conjuncts.has_value() == false)
+        {
+            is_simplified = true;
+            return false;
+        }
+
+        if (is_conjunction_simplified == false)
+        {
+            return predicate->copy();
+        }
+
+        is_simplified = true;
+        if (merged_conjuncts->empty())
+        {
+            return true;
+        }
+
+        auto conjunction = std::move(merged_conjuncts->front());
+        for (auto i = 1u; i < merged_conjuncts->size(); ++i)
+        {
+            conjunction =
+                expression::BinaryOperation::make_and(std::move(conjunction), std::move(merged_conjuncts->at(i)));
+        }
+
+        return conjunction;
+    }
+    else if (predicate->type() == expression::Operation::Type::Or)
+    {
+        const auto *binary = reinterpret_cast<const expression::BinaryOperation *>(predicate.get());
+        auto is_disjunction_simplified = false;
+        auto left = PredicateSimplificationOptimizationRule::simplify(binary->left_child(), is_disjunction_simplified);
+        auto right =
+            PredicateSimplificationOptimizationRule::simplify(binary->right_child(), is_disjunction_simplified);
+
+        if (is_disjunction_simplified == false)
+        {
+            return predicate->copy();
+        }
+
+        is_simplified = true;
+        if (std::holds_alternative<bool>(left))
+        {
+            return std::get<bool>(left) ? SimplifiedPredicate{true} : std::move(right);
+        }
+        if (std::holds_alternative<bool>(right))
+        {
+            return std::get<bool>(right) ? SimplifiedPredicate{true} : std::move(left);
+        }
+
+        return expression::BinaryOperation::make_or(std::move(std::get<std::unique_ptr<expression::Operation>>(left)),
+                                                    std::move(std::get<std::unique_ptr<expression::Operation>>(right)));
+    }
+    else if (predicate->is_comparison())
+    {
+        const auto *binary = reinterpret_cast<const expression::BinaryOperation *>(predicate.get());
+        auto is_folded = false;
+        auto left = PredicateSimplificationOptimizationRule::fold(binary->left_child(), is_folded);
+        auto right = PredicateSimplificationOptimizationRule::fold(binary->right_child(), is_folded);
+
+        // Compare two constants.
+        if (left->is_nullary() && right->is_nullary())
+        {
+            const auto &left_term = reinterpret_cast<expression::NullaryOperation *>(left.get())->term();
+            const auto &right_term = reinterpret_cast<expression::NullaryOperation *>(right.get())->term();
+            const auto comparison = PredicateSimplificationOptimizationRule::compare(left_term, right_term);
+            if (comparison.has_value())
+            {
+                is_simplified = true;
+                switch (predicate->type())
+                {
+                case expression::Operation::Type::Equals:
+                    return comparison.value() == 0;
+                case expression::Operation::Type::NotEquals:
+                    return comparison.value() != 0;
+                case expression::Operation::Type::Lesser:
+                    return comparison.value() < 0;
+                case expression::Operation::Type::LesserEquals:
+                    return comparison.value() <= 0;
+                case expression::Operation::Type::Greater:
+                    return comparison.value() > 0;
+                default:
+                    return comparison.value() >= 0;
+                }
+            }
+        }
+
+        if (is_folded)
+        {
+            is_simplified = true;
+            return PredicateSimplificationOptimizationRule::make_operation(predicate->type(), std::move(left),
+                                                                          std::move(right));
+        }
+    }
+
+    return predicate->copy();
+}
+
+std::unique_ptr<beedb::expression::Operation> PredicateSimplificationOptimizationRule::fold(
+    const std::unique_ptr<expression::Operation> &operand, bool &is_folded)
+{
+    if (operand->is_arithmetic() == false)
+    {
+        return operand->copy();
+    }
+
+    const auto *binary = reinterpret_cast<const expression::BinaryOperation *>(operand.get());
+    auto is_child_folded = false;
+    auto left = PredicateSimplificationOptimizationRule::fold(binary->left_child(), is_child_folded);
+    auto right = PredicateSimplificationOptimizationRule::fold(binary->right_child(), is_child_folded);
+
+    if (left->is_nullary() && right->is_nullary())
+    {
+        const auto &left_term = reinterpret_cast<expression::NullaryOperation *>(left.get())->term();
+        const auto &right_term = reinterpret_cast<expression::NullaryOperation *>(right.get())->term();
+        if (PredicateSimplificationOptimizationRule::is_numeric(left_term) &&
+            PredicateSimplificationOptimizationRule::is_numeric(right_term))
+        {
+            const auto &left_value = left_term.attribute_or_value();
+            const auto &right_value = right_term.attribute_or_value();
+
+            // Types are promoted like the values while executing: DECIMAL > LONG > INT.
+            if (std::holds_alternative<double>(left_value) || std::holds_alternative<double>(right_value))
+            {
+                const auto as_double = [](const auto &value) {
+                    if (std::holds_alternative<double>(value))
+                    {
+                        return std::get<double>(value);
+                    }
+                    return std::holds_alternative<std::int64_t>(value) ? double(std::get<std::int64_t>(value))
+                                                                        : double(std::get<std::int32_t>(value));
+                };
+                const auto l = as_double(left_value);
+                const auto r = as_double(right_value);
+                std::optional<double> result{};
+                switch (operand->type())
+                {
+                case expression::Operation::Type::Add:
+                    result = l + r;
+                    break;
+                case expression::Operation::Type::Sub:
+                    result = l - r;
+                    break;
+                case expression::Operation::Type::Multiply:
+                    result = l * r;
+                    break;
+                default:
+                    if (r != 0.0)
+                    {
+                        result = l / r;
+                    }
+                    break;
+                }
+
+                if (result.has_value())
+                {
+                    is_folded = true;
+                    return std::make_unique<expression::NullaryOperation>(expression::Term{result.value()});
+                }
+            }
+            else
+            {
+                const auto as_long = [](const auto &value) -> std::int64_t {
+                    return std::holds_alternative<std::int64_t>(value) ? std::get<std::int64_t>(value)
+                                                                        : std::get<std::int32_t>(value);
+                };
+                const auto l = as_long(left_value);
+                const auto r = as_long(right_value);
+
+                // Overflowing operations are left to the execution.
+                std::optional<std::int64_t> result{};
+                auto value = std::int64_t{0};
+                switch (operand->type())
+                {
+                case expression::Operation::Type::Add:
+                    if (__builtin_add_overflow(l, r, &value) == false)
+                    {
+                        result = value;
+                    }
+                    break;
+                case expression::Operation::Type::Sub:
+                    if (__builtin_sub_overflow(l, r, &value) == false)
+                    {
+                        result = value;
+                    }
+                    break;
+                case expression::Operation::Type::Multiply:
+                    if (__builtin_mul_overflow(l, r, &value) == false)
+                    {
+                        result = value;
+                    }
+                    break;
+                default:
+                    if (r != 0 && (l == std::numeric_limits<std::int64_t>::min() && r == -1) == false)
+                    {
+                        result = l / r;
+                    }
+                    break;
+                }
+
+                const auto is_long = std::holds_alternative<std::int64_t>(left_value) ||
+                                     std::holds_alternative<std::int64_t>(right_value);
+                if (result.has_value() && is_long)
+                {
+                    is_folded = true;
+                    return std::make_unique<expression::NullaryOperation>(expression::Term{result.value()});
+                }
+                else if (result.has_value() && result.value() >= std::numeric_limits<std::int32_t>::min() &&
+                         result.value() <= std::numeric_limits<std::int32_t>::max())
+                {
+                    is_folded = true;
+                    return std::make_unique<expression::NullaryOperation>(
+                        expression::Term{static_cast<std::int32_t>(result.value())});
+                }
+            }
+        }
+    }
+
+    if (is_child_folded)
+    {
+        is_folded = true;
+        return PredicateSimplificationOptimizationRule::make_operation(operand->type(), std::move(left),
+                                                                      std::move(right));
+    }
+
+    return operand->copy();
+}
+
+std::optional<std::vector<std::unique_ptr<beedb::expression::Operation>>> PredicateSimplificationOptimizationRule::
+    merge_ranges(std::vector<std::unique_ptr<expression::Operation>> &&conjuncts, bool &is_simplified)
+{
+    struct Range
+    {
+        expression::Term attribute;
+        std::optional<std::pair<expression::Term, bool>> lower{};
+        std::optional<std::pair<expression::Term, bool>> upper{};
+        std::optional<expression::Term> equals{};
+        std::vector<expression::Term> not_equals{};
+        std::size_t count_comparisons = 0u;
+    };
+
+    std::vector<std::unique_ptr<expression::Operation>> merged_conjuncts;
+    merged_conjuncts.reserve(conjuncts.size());
+    std::vector<Range> ranges;
+
+    for (auto &conjunct : conjuncts)
+    {
+        if (conjunct->is_comparison() == false)
+        {
+            merged_conjuncts.emplace_back(std::move(conjunct));
+            continue;
+        }
+
+        const auto *binary = reinterpret_cast<expression::BinaryOperation *>(conjunct.get());
+        if (binary->left_child()->is_nullary() == false || binary->right_child()->is_nullary() == false)
+        {
+            merged_conjuncts.emplace_back(std::move(conjunct));
+            continue;
+        }
+
+        // Normalize to "attribute <op> value".
+        auto type = binary->type();
+        const auto *attribute = &reinterpret_cast<expression::NullaryOperation *>(binary->left_child().get())->term();
+        const auto *value = &reinterpret_cast<expression::NullaryOperation *>(binary->right_child().get())->term();
+        if (attribute->is_attribute() == false)
+        {
+            std::swap(attribute, value);
+            switch (type)
+            {
+            case expression::Operation::Type::Lesser:
+                type = expression::Operation::Type::Greater;
+                break;
+            case expression::Operation::Type::LesserEquals:
+                type = expression::Operation::Type::GreaterEquals;
+                break;
+            case expression::Operation::Type::Greater:
+                type = expression::Operation::Type::Lesser;
+                break;
+            case expression::Operation::Type::GreaterEquals:
+                type = expression::Operation::Type::LesserEquals;
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (attribute->is_attribute() == false || PredicateSimplificationOptimizationRule::is_numeric(*value) == false)
+        {
+            merged_conjuncts.emplace_back(std::move(conjunct));
+            continue;
+        }
+
+        const auto &attribute_name = attribute->get<expression::Attribute>();
+        auto range = std::find_if(ranges.begin(), ranges.end(), [&attribute_name](const auto &range_) {
+            const auto &other = range_.attribute.template get<expression::Attribute>();
+            return other.table_name() == attribute_name.table_name() &&
+                   other.column_name() == attribute_name.column_name();
+        });
+        if (range == ranges.end())
+        {
+            ranges.emplace_back(Range{expression::Term{attribute_name}});
+            range = std::prev(ranges.end());
+        }
+
+        ++range->count_comparisons;
+        switch (type)
+        {
+        case expression::Operation::Type::Equals:
+            if (range->equals.has_value() &&
+                PredicateSimplificationOptimizationRule::compare(range->equals.value(), *value) != 0)
+            {
+                return std::nullopt;
+            }
+            range->equals = *value;
+            break;
+        case expression::Operation::Type::NotEquals:
+            range->not_equals.push_back(*value);
+            break;
+        case expression::Operation::Type::Greater:
+        case expression::Operation::Type::GreaterEquals: {
+            const auto is_inclusive = type == expression::Operation::Type::GreaterEquals;
+            const auto comparison = range->lower.has_value()
+                                        ? PredicateSimplificationOptimizationRule::compare(*value, range->lower->first)
+                                        : std::nullopt;
+            if (range->lower.has_value() == false || comparison > 0 || (comparison == 0 && is_inclusive == false))
+            {
+                range->lower = std::make_pair(*value, is_inclusive);
+            }
+            break;
+        }
+        default: {
+            const auto is_inclusive = type == expression::Operation::Type::LesserEquals;
+            const auto comparison = range->upper.has_value()
+                                        ? PredicateSimplificationOptimizationRule::compare(*value, range->upper->first)
+                                        : std::nullopt;
+            if (range->upper.has_value() == false || comparison < 0 || (comparison == 0 && is_inclusive == false))
+            {
+                range->upper = std::make_pair(*value, is_inclusive);
+            }
+            break;
+        }
+        }
+    }
+
+    for (auto &range : ranges)
+    {
+        // An interval with a single value is an equality.
+        if (range.lower.has_value() && range.upper.has_value())
+        {
+            const auto comparison =
+                PredicateSimplificationOptimizationRule::compare(range.lower->first, range.upper->first).value();
+            if (comparison > 0 || (comparison == 0 && (range.lower->second == false || range.upper->second == false)))
+            {
+                return std::nullopt;
+            }
+            if (comparison == 0)
+            {
+                if (range.equals.has_value() &&
+                    PredicateSimplificationOptimizationRule::compare(range.equals.value(), range.lower->first) != 0)
+                {
+                    return std::nullopt;
+                }
+                range.equals = range.lower->first;
+            }
+        }
+
+        auto count_merged = 0u;
+        if (range.equals.has_value())
+        {
+            const auto &value = range.equals.value();
+            if (range.lower.has_value())
+            {
+                const auto comparison = PredicateSimplificationOptimizationRule::compare(value, range.lower->first);
+                if (comparison < 0 || (comparison == 0 && range.lower->second == false))
+                {
+                    return std::nullopt;
+                }
+            }
+            if (range.upper.has_value())
+            {
+                const auto comparison = PredicateSimplificationOptimizationRule::compare(value, range.upper->first);
+                if (comparison > 0 || (comparison == 0 && range.upper->second == false))
+                {
+                    return std::nullopt;
+                }
+            }
+            for (const auto &not_equal_value : range.not_equals)
+            {
+                if (PredicateSimplificationOptimizationRule::compare(value, not_equal_value) == 0)
+                {
+                    return std::nullopt;
+                }
+            }
+
+            merged_conjuncts.emplace_back(expression::BinaryOperation::make_equals(
+                std::make_unique<expression::NullaryOperation>(expression::Term{range.attribute}),
+                std::make_unique<expression::NullaryOperation>(expression::Term{value})));
+            count_merged = 1u;
+        }
+        else
+        {
+            if (range.lower.has_value())
+            {
+                merged_conjuncts.emplace_back(PredicateSimplificationOptimizationRule::make_operation(
+                    range.lower->second ? expression::Operation::Type::GreaterEquals
+                                        : expression::Operation::Type::Greater,
+                    std::make_unique<expression::NullaryOperation>(expression::Term{range.attribute}),
+                    std::make_unique<expression::NullaryOperation>(expression::Term{range.lower->first})));
+                ++count_merged;
+            }
+            if (range.upper.has_value())
+            {
+                merged_conjuncts.emplace_back(PredicateSimplificationOptimizationRule::make_operation(
+                    range.upper->second ? expression::Operation::Type::LesserEquals
+                                        : expression::Operation::Type::Lesser,
+                    std::make_unique<expression::NullaryOperation>(expression::Term{range.attribute}),
+                    std::make_unique<expression::NullaryOperation>(expression::Term{range.upper->first})));
+                ++count_merged;
+            }
+            for (const auto &not_equal_value : range.not_equals)
+            {
+                merged_conjuncts.emplace_back(expression::BinaryOperation::make_not_equals(
+                    std::make_unique<expression::NullaryOperation>(expression::Term{range.attribute}),
+                    std::make_unique<expression::NullaryOperation>(expression::Term{not_equal_value})));
+                ++count_merged;
+            }
+        }
+
+        if (count_merged < range.count_comparisons)
+        {
+            is_simplified = true;
+        }
+    }
+
+    return merged_conjuncts;
+}
+
+std::optional<std::int32_t> PredicateSimplificationOptimizationRule::compare(const expression::Term &left,
+                                                                           const expression::Term &right)
+{
+    const auto &left_value = left.attribute_or_value();
+    const auto &right_value = right.attribute_or_value();
+
+    if (PredicateSimplificationOptimizationRule::is_numeric(left) &&
+        PredicateSimplificationOptimizationRule::is_numeric(right))
+    {
+        if (std::holds_alternative<double>(left_value) || std::holds_alternative<double>(right_value))
+        {
+            const auto to_double = [](const auto &value) {
+                if (std::holds_alternative<double>(value))
+                {
+                    return std::get<double>(value);
+                }
+                return std::holds_alternative<std::int64_t>(value) ? double(std::get<std::int64_t>(value))
+                                                                    : double(std::get<std::int32_t>(value));
+            };
+            const auto l = to_double(left_value);
+            const auto r = to_double(right_value);
+            return l < r ? -1 : (l > r ? 1 : 0);
+        }
+
+        const auto to_long = [](const auto &value) -> std::int64_t {
+            return std::holds_alternative<std::int64_t>(value) ? std::get<std::int64_t>(value)
+                                                                : std::get<std::int32_t>(value);
+        };
+        const auto l = to_long(left_value);
+        const auto r = to_long(right_value);
+        return l < r ? -1 : (l > r ? 1 : 0);
+    }
+
+    if (std::holds_alternative<std::string>(left_value) && std::holds_alternative<std::string>(right_value))
+    {
+        const auto comparison = std::get<std::string>(left_value).compare(std::get<std::string>(right_value));
+        return comparison < 0 ? -1 : (comparison > 0 ? 1 : 0);
+    }
+
+    return std::nullopt;
+}
+
+bool PredicateSimplificationOptimizationRule::is_numeric(const expression::Term &term)
+{
+    const auto &value = term.attribute_or_value();
+    return std::holds_alternative<std::int32_t>(value) || std::holds_alternative<std::int64_t>(value) ||
+           std::holds_alternative<double>(value);
+}
+
+std::unique_ptr<beedb::expression::BinaryOperation> PredicateSimplificationOptimizationRule::make_operation(
+    const expression::Operation::Type type, std::unique_ptr<expression::Operation> &&left_child,
+    std::unique_ptr<expression::Operation> &&right_child)
+{
+    switch (type)
+    {
+    case expression::Operation::Type::Equals:
+        return expression::BinaryOperation::make_equals(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::NotEquals:
+        return expression::BinaryOperation::make_not_equals(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::Lesser:
+        return expression::BinaryOperation::make_lesser(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::LesserEquals:
+        return expression::BinaryOperation::make_lesser_equals(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::Greater:
+        return expression::BinaryOperation::make_greater(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::GreaterEquals:
+        return expression::BinaryOperation::make_greater_equals(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::Add:
+        return expression::BinaryOperation::make_add(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::Sub:
+        return expression::BinaryOperation::make_sub(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::Multiply:
+        return expression::BinaryOperation::make_mul(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::Divide:
+        return expression::BinaryOperation::make_div(std::move(left_child), std::move(right_child));
+    case expression::Operation::Type::Or:
+        return expression::BinaryOperation::make_or(std::move(left_child), std::move(right_child));
+    default:
+        return expression::BinaryOperation::make_and(std::move(left_child), std::move(right_child));
+    }
+}
+
+bool PredicateSimplificationOptimizationRule::is_below_empty_result(const PlanView &plan, PlanView::node_t node)
+{
+    for (auto *parent = plan.parent(node); parent != nullptr; parent = plan.parent(parent))
+    {
+        if (typeid(*parent) == typeid(EmptyNode))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -23,15 +23,19 @@
 #include <exception/execution_exception.h>
 #include <execution/add_to_index_operator.h>
 #include <execution/aggregate_operator.h>
+#include <execution/analyze_operator.h>
 #include <execution/arithmetic_operator.h>
 #include <execution/build_index_operator.h>
+#include <execution/cardinality_recording_operator.h>
 #include <execution/create_index_operator.h>
 #include <execution/create_table_operator.h>
 #include <execution/cross_product_operator.h>
 #include <execution/delete_operator.h>
+#include <execution/empty_operator.h>
 #include <execution/hash_join_operator.h>
 #include <execution/index_scan_operator.h>
 #include <execution/insert_operator.h>
+#include <execution/instrumented_operator.h>
 #include <execution/limit_operator.h>
 #include <execution/nested_loops_join_operator.h>
 #include <execution/order_operator.h>
@@ -42,11 +46,13 @@
 #include <execution/tuple_buffer_operator.h>
 #include <execution/update_operator.h>
 #include <plan/logical/node/aggregation_node.h>
+#include <plan/logical/node/analyze_node.h>
 #include <plan/logical/node/arithmetic_node.h>
 #include <plan/logical/node/create_index_node.h>
 #include <plan/logical/node/create_table_node.h>
 #include <plan/logical/node/cross_product_node.h>
 #include <plan/logical/node/delete_node.h>
+#include <plan/logical/node/empty_node.h>
 #include <plan/logical/node/insert_node.h>
 #include <plan/logical/node/join_node.h>
 #include <plan/logical/node/limit_node.h>
@@ -80,6 +86,31 @@ std::unique_ptr<beedb::execution::OperatorInterface> Builder::build_operator(
     Database &database, concurrency::Transaction *transaction, concurrency::TransactionCallback &transaction_callback,
     bool add_to_scan_set, concurrency::ScanSetItem *scan_set,
     const std::unique_ptr<logical::NodeInterface> &logical_plan)
+{
+    auto execution_operator = Builder::build_node_operator(database, transaction, transaction_callback,
+                                                           add_to_scan_set, scan_set, logical_plan);
+
+    /// Record the actual cardinality of estimated nodes for the cardinality feedback.
+    if (execution_operator != nullptr && logical_plan->estimated_cardinality().has_value())
+    {
+        execution_operator = std::make_unique<execution::CardinalityRecordingOperator>(
+            transaction, std::move(execution_operator), logical_plan->actual_cardinality());
+    }
+
+    /// Record runtime statistics of analyzed nodes (EXPLAIN ANALYZE).
+    if (execution_operator != nullptr && logical_plan->operator_statistics().has_value())
+    {
+        execution_operator = std::make_unique<execution::InstrumentedOperator>(
+            transaction, std::move(execution_operator), logical_plan->operator_statistics().value());
+    }
+
+    return execution_operator;
+}
+
+std::unique_ptr<beedb::execution::OperatorInterface> Builder::build_node_operator(
+    Database &database, concurrency::Transaction *transaction, concurrency::TransactionCallback &transaction_callback,
+    bool add_to_scan_set, concurrency::ScanSetItem *scan_set,
+    const std::unique_ptr<logical::NodeInterface> &logical_plan)
 {
     if (logical_plan == nullptr)
     {
@@ -119,15 +150,6 @@ std::unique_ptr<beedb::execution::OperatorInterface> Builder::build_operator(
         auto table = database.table(index_scan_node->table().table_name());
         auto schema = table::Schema{table->schema(), index_scan_node->schema()};
 
-        auto key_ranges = Builder::extract_key_ranges(index_scan_node->predicate());
-        bool needs_range = std::find_if(key_ranges.cbegin(), key_ranges.cend(), [](const auto &key_range) {
-                               return key_range.single_key() == false;
-                           }) != key_ranges.cend();
-
-        const auto indexed_column_name = index_scan_node->attribute().column_name();
-        const auto indexed_column_index = schema.column_index(indexed_column_name);
-        assert(indexed_column_index.has_value());
-        auto index = schema.column(indexed_column_index.value()).index(needs_range);
         if (add_to_scan_set)
         {
             if (scan_set == nullptr)
@@ -141,9 +163,24 @@ std::unique_ptr<beedb::execution::OperatorInterface> Builder::build_operator(
             transaction->add_to_scan_set(scan_set);
         }
 
+        if (index_scan_node->order().has_value())
+        {
+            return Builder::build_ordered_index_scan(database, transaction, *table, std::move(schema),
+                                                     index_scan_node->order().value(), index_scan_node->predicate());
+        }
+
+        // Indices may have been dropped between optimization and execution; scan the whole table instead.
+        auto lookup = Builder::build_index_lookup(index_scan_node->predicate(), table->schema());
+        if (lookup == nullptr)
+        {
+            return std::make_unique<execution::SequentialScanOperator>(
+                transaction, static_cast<std::uint32_t>(database.config()[Config::k_ScanPageLimit]), std::move(schema),
+                database.buffer_manager(), database.table_disk_manager(), *table);
+        }
+
         return std::make_unique<execution::IndexScanOperator>(
             transaction, static_cast<std::uint32_t>(database.config()[Config::k_ScanPageLimit]), schema,
-            database.buffer_manager(), database.table_disk_manager(), std::move(key_ranges), index);
+            database.buffer_manager(), database.table_disk_manager(), std::move(lookup));
     }
     else if (typeid(*logical_node) == typeid(logical::ProjectionNode))
     {
@@ -393,6 +430,14 @@ std::unique_ptr<beedb::execution::OperatorInterface> Builder::build_operator(
         order_by_operator->child(std::move(child));
         return order_by_operator;
     }
+    else if (typeid(*logical_node) == typeid(logical::EmptyNode))
+    {
+        // The child is only built to provide the schema; nothing will be scanned.
+        auto *empty_node = reinterpret_cast<logical::EmptyNode *>(logical_node);
+        auto child = Builder::build_operator(database, transaction, transaction_callback, false, nullptr,
+                                             empty_node->child());
+        return std::make_unique<execution::EmptyOperator>(transaction, std::move(child));
+    }
     else if (typeid(*logical_node) == typeid(logical::LimitNode))
     {
         auto *limit_node = reinterpret_cast<logical::LimitNode *>(logical_node);
@@ -523,10 +568,30 @@ std::unique_ptr<beedb::execution::OperatorInterface> Builder::build_operator(
         delete_operator->child(std::move(child));
         return delete_operator;
     }
+    else if (typeid(*logical_node) == typeid(logical::AnalyzeNode))
+    {
+        auto *analyze_node = reinterpret_cast<logical::AnalyzeNode *>(logical_node);
+
+        auto tables = std::vector<table::Table *>{};
+        if (analyze_node->table_name().has_value())
+        {
+            tables.push_back(database.table(analyze_node->table_name().value()));
+        }
+        else
+        {
+            tables = database.tables();
+        }
+
+        return std::make_unique<execution::AnalyzeOperator>(
+            database, transaction, std::move(tables),
+            static_cast<std::uint32_t>(database.config()[Config::k_AnalyzeSamplePages]));
+    }
     else if (typeid(*logical_node) == typeid(logical::BeginTransactionNode))
     {
-        return std::make_unique<execution::BeginTransactionOperator>(database.transaction_manager(),
-                                                                     transaction_callback);
+        auto *begin_node = reinterpret_cast<logical::BeginTransactionNode *>(logical_node);
+        return std::make_unique<execution::BeginTransactionOperator>(
+            database.transaction_manager(), transaction_callback, begin_node->isolation_level(),
+            begin_node->is_read_only());
     }
     else if (typeid(*logical_node) == typeid(logical::AbortTransactionNode))
     {
@@ -981,67 +1046,65 @@ std::unordered_set<beedb::execution::KeyRange> Builder::extract_key_ranges(
             auto key_range = std::unordered_set<execution::KeyRange>{};
             auto *left = reinterpret_cast<expression::NullaryOperation *>(binary->left_child().get());
             auto *right = reinterpret_cast<expression::NullaryOperation *>(binary->right_child().get());
-            if (left->term().is_value() && right->term().is_attribute()) // e.g. 5 < id
+            const auto is_value_left = left->term().is_value() && right->term().is_attribute(); // e.g. 5 < id
+            if (is_value_left == false && (left->term().is_attribute() && right->term().is_value()) == false)
             {
-                const auto &key = Builder::extract_key(left->term());
-                if (key.has_value() == false)
-                {
-                    return key_range;
-                }
-
-                if (binary->type() == expression::Operation::Type::Equals)
-                {
-                    key_range.insert(execution::KeyRange{key.value()});
-                }
-                else if (binary->type() == expression::Operation::Type::Lesser)
-                {
-                    key_range.insert(execution::KeyRange{key.value() + 1, std::numeric_limits<std::int64_t>::max()});
-                }
-                else if (binary->type() == expression::Operation::Type::LesserEquals)
-                {
-                    key_range.insert(execution::KeyRange{key.value(), std::numeric_limits<std::int64_t>::max()});
-                }
-                else if (binary->type() == expression::Operation::Type::Greater)
-                {
-                    key_range.insert(
-                        execution::KeyRange{std::numeric_limits<std::int64_t>::min() + 1, key.value() - 1});
-                }
-                else if (binary->type() == expression::Operation::Type::GreaterEquals)
-                {
-                    key_range.insert(execution::KeyRange{std::numeric_limits<std::int64_t>::min() + 1, key.value()});
-                }
+                return key_range;
             }
-            else if (left->term().is_attribute() && right->term().is_value()) // eg. id < 5
+
+            const auto key = Builder::extract_key(is_value_left ? left->term() : right->term());
+            if (key.has_value() == false)
             {
-                const auto &key = Builder::extract_key(right->term());
-                if (key.has_value() == false)
-                {
-                    return key_range;
-                }
+                return key_range;
+            }
 
-                if (binary->type() == expression::Operation::Type::Equals)
-                {
-                    key_range.insert(execution::KeyRange{key.value()});
-                }
-                else if (binary->type() == expression::Operation::Type::Lesser)
+            // Normalize to "id <op> key"; 5 < id is the same as id > 5.
+            auto type = binary->type();
+            if (is_value_left)
+            {
+                if (type == expression::Operation::Type::Lesser)
                 {
-                    key_range.insert(
-                        execution::KeyRange{std::numeric_limits<std::int64_t>::min() + 1, key.value() - 1});
+                    type = expression::Operation::Type::Greater;
                 }
-                else if (binary->type() == expression::Operation::Type::LesserEquals)
+                else if (type == expression::Operation::Type::LesserEquals)
                 {
-                    key_range.insert(execution::KeyRange{std::numeric_limits<std::int64_t>::min() + 1, key.value()});
+                    type = expression::Operation::Type::GreaterEquals;
                 }
-                else if (binary->type() == expression::Operation::Type::Greater)
+                else if (type == expression::Operation::Type::Greater)
                 {
-                    key_range.insert(execution::KeyRange{key.value() + 1, std::numeric_limits<std::int64_t>::max()});
+                    type = expression::Operation::Type::Lesser;
                 }
-                else if (binary->type() == expression::Operation::Type::GreaterEquals)
+                else if (type == expression::Operation::Type::GreaterEquals)
                 {
-                    key_range.insert(execution::KeyRange{key.value(), std::numeric_limits<std::int64_t>::max()});
+                    type = expression::Operation::Type::LesserEquals;
                 }
             }
 
+            // Keys at the bounds of the key domain would overflow the exclusive
+            // ranges; no range is extracted and the predicate is left to the selection.
+            constexpr auto min_key = std::numeric_limits<std::int64_t>::min() + 1;
+            constexpr auto max_key = std::numeric_limits<std::int64_t>::max();
+            if (type == expression::Operation::Type::Equals)
+            {
+                key_range.insert(execution::KeyRange{key.value()});
+            }
+            else if (type == expression::Operation::Type::Lesser && key.value() > min_key)
+            {
+                key_range.insert(execution::KeyRange{min_key, key.value() - 1});
+            }
+            else if (type == expression::Operation::Type::LesserEquals)
+            {
+                key_range.insert(execution::KeyRange{min_key, key.value()});
+            }
+            else if (type == expression::Operation::Type::Greater && key.value() < max_key)
+            {
+                key_range.insert(execution::KeyRange{key.value() + 1, max_key});
+            }
+            else if (type == expression::Operation::Type::GreaterEquals)
+            {
+                key_range.insert(execution::KeyRange{key.value(), max_key});
+            }
+
             return key_range;
         }
     }
@@ -1049,6 +1112,116 @@ std::unordered_set<beedb::execution::KeyRange> Builder::extract_key_ranges(
     return std::unordered_set<execution::KeyRange>{};
 }
 
+std::unique_ptr<beedb::execution::OperatorInterface> Builder::build_ordered_index_scan(
+    Database &database, concurrency::Transaction *transaction, table::Table &table, table::Schema &&schema,
+    const expression::Attribute &order, const std::unique_ptr<expression::Operation> &predicate)
+{
+    const auto key_column_index = schema.column_index(order.column_name());
+    assert(key_column_index.has_value());
+
+    // Comparisons on the ordering attribute narrow the scanned key range.
+    auto from = std::numeric_limits<std::int64_t>::min();
+    auto to = std::numeric_limits<std::int64_t>::max();
+    if (predicate != nullptr)
+    {
+        for (const auto &key_range : Builder::extract_key_ranges(predicate))
+        {
+            from = std::max(from, key_range.from());
+            to = std::min(to, key_range.to());
+        }
+    }
+
+    auto index = schema.column(key_column_index.value()).index(true);
+    if (index != nullptr)
+    {
+        return std::make_unique<execution::IndexScanOperator>(transaction, schema, database.buffer_manager(),
+                                                              database.table_disk_manager(), std::move(index),
+                                                              key_column_index.value(), execution::KeyRange{from, to});
+    }
+
+    // The index was dropped after optimization; the rows have to be sorted.
+    auto scan = std::make_unique<execution::SequentialScanOperator>(
+        transaction, static_cast<std::uint32_t>(database.config()[Config::k_ScanPageLimit]), std::move(schema),
+        database.buffer_manager(), database.table_disk_manager(), table);
+    auto order_operator = std::make_unique<execution::OrderOperator>(
+        transaction, scan->schema(),
+        std::vector<std::pair<std::uint32_t, bool>>{{std::uint32_t(key_column_index.value()), true}});
+    order_operator->child(std::move(scan));
+    return order_operator;
+}
+
+std::unique_ptr<beedb::execution::IndexLookup> Builder::build_index_lookup(
+    const std::unique_ptr<expression::Operation> &predicate, const table::Schema &schema)
+{
+    if (predicate->is_logical_connective())
+    {
+        auto *binary = reinterpret_cast<expression::BinaryOperation *>(predicate.get());
+        auto left = Builder::build_index_lookup(binary->left_child(), schema);
+        auto right = Builder::build_index_lookup(binary->right_child(), schema);
+        if (binary->type() == expression::Operation::Type::And)
+        {
+            if (left == nullptr || right == nullptr)
+            {
+                return left != nullptr ? std::move(left) : std::move(right);
+            }
+
+            return std::make_unique<execution::IndexLookup>(execution::IndexLookup::Type::Intersection, std::move(left),
+                                                            std::move(right));
+        }
+
+        if (left == nullptr || right == nullptr)
+        {
+            return nullptr;
+        }
+
+        return std::make_unique<execution::IndexLookup>(execution::IndexLookup::Type::Union, std::move(left),
+                                                        std::move(right));
+    }
+    else if (predicate->is_comparison())
+    {
+        auto *binary = reinterpret_cast<expression::BinaryOperation *>(predicate.get());
+        if (binary->left_child()->is_nullary() == false || binary->right_child()->is_nullary() == false)
+        {
+            return nullptr;
+        }
+
+        const auto &left_term = reinterpret_cast<expression::NullaryOperation *>(binary->left_child().get())->term();
+        const auto &right_term = reinterpret_cast<expression::NullaryOperation *>(binary->right_child().get())->term();
+        const auto &attribute_term = left_term.is_attribute() ? left_term : right_term;
+        if (attribute_term.is_attribute() == false)
+        {
+            return nullptr;
+        }
+
+        const auto column_index = schema.column_index(attribute_term.get<expression::Attribute>().column_name());
+        if (column_index.has_value() == false)
+        {
+            return nullptr;
+        }
+
+        // Without key ranges (e.g. comparisons with non-integer values), the index
+        // can not answer the predicate; an empty lookup would drop matching rows.
+        auto key_ranges = Builder::extract_key_ranges(predicate);
+        if (key_ranges.empty())
+        {
+            return nullptr;
+        }
+
+        const auto needs_range = std::find_if(key_ranges.cbegin(), key_ranges.cend(), [](const auto &key_range) {
+                                     return key_range.is_single_key() == false;
+                                 }) != key_ranges.cend();
+        auto index = schema.column(column_index.value()).index(needs_range);
+        if (index == nullptr)
+        {
+            return nullptr;
+        }
+
+        return std::make_unique<execution::IndexLookup>(std::move(index), std::move(key_ranges));
+    }
+
+    return nullptr;
+}
+
 std::optional<std::int64_t> Builder::extract_key(const expression::Term &term)
 {
     const auto &value = term.attribute_or_value();
@@ -1058,7 +1231,7 @@ std::optional<std::int64_t> Builder::extract_key(const expression::Term &term)
     }
     else if (std::holds_alternative<std::int32_t>(value))
     {
-        return std::make_optional(std::int64_t(std::get<std::int64_t>(value)));
+        return std::make_optional(std::int64_t(std::get<std::int32_t>(value)));
     }
 
     return std::nullopt;
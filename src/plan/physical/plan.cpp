@@ -33,32 +33,42 @@ std::uint64_t Plan::execute(io::ExecutionCallback &execution_callback)
 
     auto count = std::uint64_t{0u};
 
-    this->_root->open();
-
-    const auto yield_data = this->_root->yields_data();
-    if (yield_data)
+    // Operators release their pinned pages on close, also when the execution or opening
+    // (e.g., building hash tables) failed or was cancelled.
+    try
     {
-        execution_callback.on_schema(this->_root->schema());
-    }
+        this->_root->open();
 
-    auto tuple = this->_root->next();
-    if (yield_data)
-    {
-        while (tuple == true)
+        const auto yield_data = this->_root->yields_data();
+        if (yield_data)
         {
-            execution_callback.on_tuple(tuple);
-            ++count;
-            tuple = this->_root->next();
+            execution_callback.on_schema(this->_root->schema());
         }
-    }
-    else
-    {
-        while (tuple == true)
+
+        auto tuple = this->_root->next();
+        if (yield_data)
+        {
+            while (tuple == true)
+            {
+                execution_callback.on_tuple(tuple);
+                ++count;
+                tuple = this->_root->next();
+            }
+        }
+        else
         {
-            ++count;
-            tuple = this->_root->next();
+            while (tuple == true)
+            {
+                ++count;
+                tuple = this->_root->next();
+            }
         }
     }
+    catch (...)
+    {
+        this->_root->close();
+        throw;
+    }
 
     this->_root->close();
 
@@ -0,0 +1,284 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception/disk_exception.h>
+#include <fcntl.h>
+#include <recovery/log_manager.h>
+#include <unistd.h>
+
+using namespace beedb::recovery;
+
+LogManager::LogManager(const std::string &file_name) : _file_name(file_name)
+{
+    this->_file_descriptor = ::open(file_name.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (this->_file_descriptor < 0)
+    {
+        throw exception::CanNotOpenStorageFile(file_name);
+    }
+
+    const auto size = ::lseek(this->_file_descriptor, 0, SEEK_END);
+    if (size <= 0)
+    {
+        // New log: write the header.
+        this->write(std::vector<std::byte>{reinterpret_cast<const std::byte *>(MAGIC),
+                                           reinterpret_cast<const std::byte *>(MAGIC) + sizeof(MAGIC)});
+        this->_next_lsn = this->_flushed_lsn = LogManager::begin_lsn();
+    }
+    else
+    {
+        char magic[sizeof(MAGIC)];
+        if (::pread(this->_file_descriptor, magic, sizeof(MAGIC), 0) != sizeof(MAGIC) ||
+            std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+        {
+            ::close(this->_file_descriptor);
+            throw exception::CanNotOpenStorageFile(file_name);
+        }
+
+        // Everything already in the file is durable.
+        this->_next_lsn = this->_flushed_lsn = lsn_t(size);
+    }
+}
+
+LogManager::~LogManager()
+{
+    try
+    {
+        this->flush();
+    }
+    catch (exception::CanNotWriteLogException &)
+    {
+        // Recovery repeats everything up to the last durable record.
+    }
+    ::close(this->_file_descriptor);
+}
+
+lsn_t LogManager::append(const LogRecord &record)
+{
+    std::lock_guard _{this->_latch};
+    const auto lsn = this->_next_lsn;
+    record.serialize(this->_buffer);
+    this->_next_lsn += record.size();
+
+    if (record.is_modification())
+    {
+        this->_active_transactions.try_emplace(record.transaction(), lsn);
+    }
+    else if (record.type() == LogRecord::Type::Commit || record.type() == LogRecord::Type::Abort)
+    {
+        this->_active_transactions.erase(record.transaction());
+    }
+
+    return lsn;
+}
+
+lsn_t LogManager::append_checkpoint(const lsn_t begin_lsn,
+                                    const std::vector<std::pair<storage::Page::id_t, lsn_t>> &dirty_pages)
+{
+    std::lock_guard _{this->_latch};
+    const auto active_transactions = std::vector<std::pair<concurrency::timestamp::timestamp_t, lsn_t>>{
+        this->_active_transactions.begin(), this->_active_transactions.end()};
+    const auto record = LogRecord::make_checkpoint(begin_lsn, dirty_pages, active_transactions);
+
+    const auto lsn = this->_next_lsn;
+    record.serialize(this->_buffer);
+    this->_next_lsn += record.size();
+
+    // Recovery starts the analysis at the begin, redo and undo may need older records.
+    auto recovery_lsn = begin_lsn;
+    for (const auto &[page_id, dirty_lsn] : dirty_pages)
+    {
+        recovery_lsn = std::min(recovery_lsn, dirty_lsn);
+    }
+    for (const auto &[transaction, first_lsn] : active_transactions)
+    {
+        recovery_lsn = std::min(recovery_lsn, first_lsn);
+    }
+    this->_checkpoint = std::make_pair(lsn, recovery_lsn);
+
+    return lsn;
+}
+
+void LogManager::clear()
+{
+    std::lock_guard _{this->_latch};
+    if (::ftruncate(this->_file_descriptor, off_t(LogManager::begin_lsn())) != 0 ||
+        ::fdatasync(this->_file_descriptor) != 0)
+    {
+        throw exception::CanNotWriteLogException(this->_file_name);
+    }
+
+    this->_buffer.clear();
+    this->_active_transactions.clear();
+    this->_checkpoint = std::make_pair(lsn_t{0u}, lsn_t{0u});
+    this->_truncated_lsn = 0u;
+    this->_next_lsn = this->_flushed_lsn = LogManager::begin_lsn();
+}
+
+void LogManager::truncate(const lsn_t checkpoint_lsn)
+{
+    std::lock_guard _{this->_latch};
+    const auto [lsn, recovery_lsn] = this->_checkpoint;
+    if (lsn != checkpoint_lsn || recovery_lsn <= this->_truncated_lsn || recovery_lsn > this->_flushed_lsn)
+    {
+        return;
+    }
+
+    // Freeing is best effort: When the file system does not support holes, the log keeps growing.
+    const auto begin = std::max(this->_truncated_lsn, LogManager::begin_lsn());
+    if (::fallocate(this->_file_descriptor, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, off_t(begin),
+                    off_t(recovery_lsn - begin)) == 0)
+    {
+        this->_truncated_lsn = recovery_lsn;
+    }
+}
+
+void LogManager::flush(const lsn_t lsn)
+{
+    std::unique_lock lock{this->_latch};
+    while (this->_flushed_lsn <= lsn && this->_flushed_lsn < this->_next_lsn)
+    {
+        if (this->_is_failed)
+        {
+            throw exception::CanNotWriteLogException(this->_file_name);
+        }
+
+        if (this->_is_flushing)
+        {
+            // Another thread leads the current group; our records may be part of it.
+            this->_flushed_condition.wait(lock);
+            continue;
+        }
+
+        // Lead the next group: take everything appended so far.
+        this->_is_flushing = true;
+        this->_flush_buffer.clear();
+        std::swap(this->_buffer, this->_flush_buffer);
+        const auto group_lsn = this->_next_lsn;
+        lock.unlock();
+
+        try
+        {
+            this->write(this->_flush_buffer);
+        }
+        catch (...)
+        {
+            // The group may be written partially; writing later records would leave a gap in the log.
+            lock.lock();
+            this->_is_failed = true;
+            this->_is_flushing = false;
+            this->_flushed_condition.notify_all();
+            throw;
+        }
+
+        lock.lock();
+        this->_flushed_lsn = group_lsn;
+        this->_is_flushing = false;
+        ++this->_count_syncs;
+        this->_flushed_condition.notify_all();
+    }
+}
+
+void LogManager::flush()
+{
+    lsn_t lsn;
+    {
+        std::lock_guard _{this->_latch};
+        lsn = this->_next_lsn;
+    }
+    this->flush(lsn);
+}
+
+std::vector<std::pair<lsn_t, LogRecord>> LogManager::read(const lsn_t lsn)
+{
+    this->flush();
+
+    std::lock_guard _{this->_latch};
+    std::vector<std::pair<lsn_t, LogRecord>> records;
+    if (lsn >= this->_flushed_lsn)
+    {
+        return records;
+    }
+
+    auto data = std::vector<std::byte>(this->_flushed_lsn - lsn);
+    auto read_bytes = std::size_t{0u};
+    while (read_bytes < data.size())
+    {
+        const auto result =
+            ::pread(this->_file_descriptor, data.data() + read_bytes, data.size() - read_bytes, lsn + read_bytes);
+        if (result <= 0)
+        {
+            break;
+        }
+        read_bytes += std::size_t(result);
+    }
+
+    auto offset = std::size_t{0u};
+    while (offset < read_bytes)
+    {
+        auto record = LogRecord::deserialize(data.data() + offset, read_bytes - offset);
+        if (record.has_value() == false)
+        {
+            break;
+        }
+        const auto size = record->size();
+        records.emplace_back(lsn + offset, std::move(record.value()));
+        offset += size;
+    }
+
+    // Cut off the torn tail, new records have to follow the last complete one.
+    if (lsn + offset < this->_flushed_lsn)
+    {
+        if (::ftruncate(this->_file_descriptor, off_t(lsn + offset)) != 0)
+        {
+            throw exception::CanNotWriteLogException(this->_file_name);
+        }
+        this->_next_lsn = this->_flushed_lsn = lsn + offset;
+    }
+
+    return records;
+}
+
+void LogManager::write(const std::vector<std::byte> &data)
+{
+    auto written = std::size_t{0u};
+    while (written < data.size())
+    {
+        const auto result = ::write(this->_file_descriptor, data.data() + written, data.size() - written);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw exception::CanNotWriteLogException(this->_file_name);
+        }
+        written += std::size_t(result);
+    }
+
+    if (::fdatasync(this->_file_descriptor) != 0)
+    {
+        throw exception::CanNotWriteLogException(this->_file_name);
+    }
+}
@@ -0,0 +1,235 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <algorithm>
+#include <concurrency/metadata.h>
+#include <cstring>
+#include <recovery/recovery_manager.h>
+#include <storage/record_page.h>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace beedb::recovery;
+
+lsn_t RecoveryManager::checkpoint(const lsn_t recovery_lsn)
+{
+    this->_buffer_manager.write_back_dirty_pages(recovery_lsn);
+
+    // Changes logged from here on are found by the analysis, dirty pages
+    // changed before are recorded; all other pages are on disk after the sync.
+    const auto begin_lsn = this->_log_manager.next_lsn();
+    const auto dirty_pages = this->_buffer_manager.dirty_pages();
+    this->_storage_manager.sync();
+
+    const auto lsn = this->_log_manager.append_checkpoint(begin_lsn, dirty_pages);
+    this->_log_manager.flush(lsn);
+    return lsn;
+}
+
+beedb::concurrency::timestamp::timestamp_t RecoveryManager::recover(const lsn_t checkpoint_lsn)
+{
+    std::unordered_map<storage::Page::id_t, lsn_t> dirty_pages;
+    std::unordered_map<concurrency::timestamp::timestamp_t, lsn_t> active_transactions;
+
+    // Without checkpoint, the whole log is analyzed.
+    auto analysis_lsn = LogManager::begin_lsn();
+    auto records = this->_log_manager.read(checkpoint_lsn > 0u ? checkpoint_lsn : analysis_lsn);
+    if (checkpoint_lsn > 0u && records.empty() == false &&
+        records.front().second.type() == LogRecord::Type::Checkpoint)
+    {
+        const auto &checkpoint = records.front().second;
+        analysis_lsn = checkpoint.checkpoint_begin_lsn();
+        auto start_lsn = analysis_lsn;
+        for (const auto &[page_id, lsn] : checkpoint.dirty_pages())
+        {
+            dirty_pages.emplace(page_id, lsn);
+            start_lsn = std::min(start_lsn, lsn);
+        }
+        for (const auto &[transaction, lsn] : checkpoint.active_transactions())
+        {
+            active_transactions.emplace(transaction, lsn);
+            start_lsn = std::min(start_lsn, lsn);
+        }
+
+        // Redo and undo may need records written before the checkpoint.
+        if (start_lsn < checkpoint_lsn)
+        {
+            records = this->_log_manager.read(start_lsn);
+        }
+    }
+
+    // Analysis.
+    auto max_timestamp = concurrency::timestamp::timestamp_t{0u};
+    std::unordered_set<concurrency::timestamp::timestamp_t> committed_transactions;
+    std::unordered_map<concurrency::timestamp::timestamp_t, concurrency::timestamp::timestamp_t> commit_timestamps;
+    for (const auto &[lsn, record] : records)
+    {
+        max_timestamp = std::max({max_timestamp, record.transaction(), record.commit_timestamp()});
+        if (record.type() == LogRecord::Type::Commit)
+        {
+            committed_transactions.insert(record.transaction());
+        }
+        else if (record.type() == LogRecord::Type::Write)
+        {
+            commit_timestamps[record.transaction()] = record.commit_timestamp();
+        }
+
+        // The checkpoint holds the state of everything logged before it started.
+        if (lsn < analysis_lsn)
+        {
+            continue;
+        }
+
+        if (record.is_modification())
+        {
+            active_transactions.try_emplace(record.transaction(), lsn);
+        }
+        else if (record.type() == LogRecord::Type::Write || record.type() == LogRecord::Type::Compensation)
+        {
+            dirty_pages.try_emplace(record.record_identifier().page_id(), lsn);
+        }
+        else if (record.type() == LogRecord::Type::Commit || record.type() == LogRecord::Type::Abort)
+        {
+            active_transactions.erase(record.transaction());
+        }
+    }
+
+    // Redo: Repeat history for all pages that may have missed a change.
+    for (const auto &[lsn, record] : records)
+    {
+        const auto is_redoable =
+            record.type() == LogRecord::Type::Compensation ||
+            (record.type() == LogRecord::Type::Write && committed_transactions.count(record.transaction()) > 0u);
+        if (is_redoable)
+        {
+            const auto dirty_page = dirty_pages.find(record.record_identifier().page_id());
+            if (dirty_page != dirty_pages.end() && lsn >= dirty_page->second)
+            {
+                this->redo(record);
+            }
+        }
+    }
+
+    // Undo: Revert all modifications of transactions that did not end, newest first.
+    for (auto iterator = records.rbegin(); iterator != records.rend(); ++iterator)
+    {
+        const auto &record = iterator->second;
+        if (record.is_modification() && active_transactions.find(record.transaction()) != active_transactions.end())
+        {
+            const auto commit_timestamp = commit_timestamps.find(record.transaction());
+            this->undo(record, commit_timestamp != commit_timestamps.end()
+                                   ? std::make_optional(commit_timestamp->second)
+                                   : std::nullopt);
+        }
+    }
+
+    return max_timestamp;
+}
+
+void RecoveryManager::redo(const LogRecord &record)
+{
+    const auto record_identifier = record.record_identifier();
+    auto *page = reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(record_identifier.page_id()));
+
+    if (record.image().empty())
+    {
+        // The abort freed the slot.
+        if (record_identifier.slot() < page->slots())
+        {
+            page->erase(record_identifier.slot());
+        }
+    }
+    else
+    {
+        page->restore_slot(record_identifier.slot(), record.slot_start(), record.image().size());
+        std::memcpy((*page)[record.slot_start()], record.image().data(), record.image().size());
+    }
+
+    this->_buffer_manager.unpin(page, true);
+}
+
+void RecoveryManager::undo(const LogRecord &record,
+                           const std::optional<concurrency::timestamp::timestamp_t> commit_timestamp)
+{
+    // Records of the loser carry its begin time or, when crashed while committing, its commit time.
+    const auto uncommitted = concurrency::timestamp{record.transaction(), false};
+    const auto committed =
+        commit_timestamp.has_value() ? concurrency::timestamp{commit_timestamp.value(), true} : uncommitted;
+    const auto is_written_by_loser = [&uncommitted, &committed](const concurrency::timestamp timestamp) {
+        return timestamp == uncommitted || timestamp == committed;
+    };
+
+    const auto record_identifier = record.record_identifier();
+    auto *page = reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(record_identifier.page_id()));
+    if (record_identifier.slot() >= page->slots() || page->is_free(record_identifier.slot()))
+    {
+        // The modification never reached the disk.
+        this->_buffer_manager.unpin(page, false);
+        return;
+    }
+
+    const auto &slot = page->slot(record_identifier.slot());
+    auto *metadata = reinterpret_cast<concurrency::Metadata *>((*page)[slot.start()]);
+    if (record.type() == LogRecord::Type::Insert)
+    {
+        if (is_written_by_loser(metadata->begin_timestamp()))
+        {
+            page->erase(record_identifier.slot());
+        }
+    }
+    else if (record.type() == LogRecord::Type::Update)
+    {
+        if (is_written_by_loser(metadata->begin_timestamp()))
+        {
+            // Restore the before-image, which was versioned with the loser as end.
+            std::memcpy((*page)[slot.start()], record.image().data(),
+                        std::min(std::size_t(slot.size()), record.image().size()));
+            metadata->end_timestamp(concurrency::timestamp::make_infinity());
+        }
+
+        // Free the version in the time travel space.
+        const auto old_record_identifier = record.old_record_identifier();
+        auto *time_travel_page =
+            reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(old_record_identifier.page_id()));
+        if (old_record_identifier.slot() < time_travel_page->slots() &&
+            time_travel_page->is_free(old_record_identifier.slot()) == false)
+        {
+            const auto &time_travel_slot = time_travel_page->slot(old_record_identifier.slot());
+            const auto *time_travel_metadata =
+                reinterpret_cast<concurrency::Metadata *>((*time_travel_page)[time_travel_slot.start()]);
+            if (is_written_by_loser(time_travel_metadata->end_timestamp()))
+            {
+                time_travel_page->erase(old_record_identifier.slot());
+            }
+        }
+        this->_buffer_manager.unpin(time_travel_page, true);
+    }
+    else if (record.type() == LogRecord::Type::Delete)
+    {
+        if (is_written_by_loser(metadata->end_timestamp()))
+        {
+            metadata->end_timestamp(concurrency::timestamp::make_infinity());
+        }
+    }
+
+    this->_buffer_manager.unpin(page, true);
+}
@@ -0,0 +1,253 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <statistic/column_statistic.h>
+#include <string_view>
+
+using namespace beedb::statistic;
+
+double ColumnStatistic::to_numeric(const table::Value &value)
+{
+    switch (static_cast<table::Type::Id>(value.type()))
+    {
+    case table::Type::INT:
+        return double(value.get<std::int32_t>());
+    case table::Type::LONG:
+        return double(value.get<std::int64_t>());
+    case table::Type::DECIMAL:
+        return value.get<double>();
+    case table::Type::DATE: {
+        const auto date = value.get<table::Date>();
+        return double(date.year()) * 10000.0 + double(date.month()) * 100.0 + double(date.day());
+    }
+    case table::Type::CHAR: {
+        const auto string = std::holds_alternative<std::string>(value.value())
+                                ? std::string_view{value.get<std::string>()}
+                                : value.get<std::string_view>();
+
+        // Interpret the first characters as big endian number to keep the lexicographical order.
+        std::uint64_t numeric = 0u;
+        for (auto i = 0u; i < sizeof(std::uint64_t); ++i)
+        {
+            numeric <<= 8u;
+            if (i < string.size() && string[i] != '\0')
+            {
+                numeric |= static_cast<std::uint8_t>(string[i]);
+            }
+        }
+        return double(numeric);
+    }
+    default:
+        return 0.0;
+    }
+}
+
+std::vector<std::pair<double, double>> ColumnStatistic::most_common_values_from_string(const std::string &serialized)
+{
+    std::vector<std::pair<double, double>> most_common_values;
+    std::stringstream stream{serialized};
+    std::string item;
+    while (std::getline(stream, item, ';'))
+    {
+        const auto separator = item.find(':');
+        if (separator != std::string::npos)
+        {
+            most_common_values.emplace_back(std::stod(item.substr(0u, separator)),
+                                            std::stod(item.substr(separator + 1u)));
+        }
+    }
+
+    return most_common_values;
+}
+
+std::string ColumnStatistic::most_common_values_to_string() const
+{
+    std::stringstream stream;
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (auto i = 0u; i < this->_most_common_values.size(); ++i)
+    {
+        if (i > 0u)
+        {
+            stream << ';';
+        }
+        stream << this->_most_common_values[i].first << ':' << this->_most_common_values[i].second;
+    }
+
+    return stream.str();
+}
+
+double ColumnStatistic::selectivity_equals(const double value) const
+{
+    if (this->_count_distinct == 0u || value < this->_min || value > this->_max)
+    {
+        return 0.0;
+    }
+
+    auto most_common_frequency = 0.0;
+    for (const auto &[most_common_value, frequency] : this->_most_common_values)
+    {
+        if (most_common_value == value)
+        {
+            return frequency;
+        }
+        most_common_frequency += frequency;
+    }
+
+    // Distribute the frequency of all remaining values uniformly
+    // over the remaining distinct values.
+    const auto remaining_fraction = std::max(0.0, 1.0 - this->_null_fraction - most_common_frequency);
+    const auto remaining_distinct =
+        std::max<std::uint64_t>(1u, this->_count_distinct - std::min<std::uint64_t>(this->_count_distinct,
+                                                                                    this->_most_common_values.size()));
+
+    return remaining_fraction / double(remaining_distinct);
+}
+
+double ColumnStatistic::selectivity_lesser(const double value, const bool is_inclusive) const
+{
+    const auto not_null_fraction = 1.0 - this->_null_fraction;
+    if (this->_count_distinct == 0u)
+    {
+        return 0.0;
+    }
+
+    auto fraction = 0.0;
+    if (this->_histogram.empty() == false)
+    {
+        fraction = this->_histogram.fraction_lesser(value);
+    }
+    else if (value > this->_max)
+    {
+        fraction = 1.0;
+    }
+    else if (value > this->_min)
+    {
+        fraction = (value - this->_min) / (this->_max - this->_min);
+    }
+
+    auto selectivity = fraction * not_null_fraction;
+    if (is_inclusive)
+    {
+        selectivity += this->selectivity_equals(value);
+    }
+
+    return std::clamp(selectivity, 0.0, not_null_fraction);
+}
+
+void ColumnStatisticBuilder::add(const table::Value &value)
+{
+    ++this->_count_values;
+
+    if (value == nullptr)
+    {
+        ++this->_count_nulls;
+        return;
+    }
+
+    const auto numeric = ColumnStatistic::to_numeric(value);
+    if (this->_type == table::Type::CHAR)
+    {
+        const auto string = std::holds_alternative<std::string>(value.value())
+                                ? std::string_view{value.get<std::string>()}
+                                : value.get<std::string_view>();
+        this->_distinct_values.add(std::hash<std::string_view>()(string.substr(0u, this->_type.dynamic_length())));
+    }
+    else
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &numeric, sizeof(bits));
+        this->_distinct_values.add(bits);
+    }
+
+    this->_values.push_back(numeric);
+}
+
+ColumnStatistic ColumnStatisticBuilder::build(const std::size_t count_buckets,
+                                              const std::size_t count_most_common_values,
+                                              const double sampled_fraction)
+{
+    if (this->_count_values == 0u)
+    {
+        return ColumnStatistic{};
+    }
+
+    const auto null_fraction = double(this->_count_nulls) / double(this->_count_values);
+    if (this->_values.empty())
+    {
+        return ColumnStatistic{null_fraction, 0u, 0.0, 0.0, {}, EquiDepthHistogram{}};
+    }
+
+    std::sort(this->_values.begin(), this->_values.end());
+
+    // Count runs of equal values in the sorted list to find the most common values.
+    // A value is only "common" when it occurs more than once.
+    std::vector<std::pair<double, std::uint64_t>> runs;
+    for (auto i = 0u; i < this->_values.size();)
+    {
+        auto j = i + 1u;
+        while (j < this->_values.size() && this->_values[j] == this->_values[i])
+        {
+            ++j;
+        }
+
+        if (j - i > 1u)
+        {
+            runs.emplace_back(this->_values[i], j - i);
+        }
+        i = j;
+    }
+
+    const auto count_runs = std::min(count_most_common_values, runs.size());
+    std::partial_sort(runs.begin(), runs.begin() + count_runs, runs.end(),
+                      [](const auto &left, const auto &right) { return left.second > right.second; });
+
+    std::vector<std::pair<double, double>> most_common_values;
+    most_common_values.reserve(count_runs);
+    for (auto i = 0u; i < count_runs; ++i)
+    {
+        most_common_values.emplace_back(runs[i].first, double(runs[i].second) / double(this->_count_values));
+    }
+
+    // The sketch estimates the distinct values; but there are at least as
+    // many distinct values as we found most common values.
+    auto count_distinct = std::min<std::uint64_t>(
+        this->_values.size(), std::max<std::uint64_t>(this->_distinct_values.estimate(), most_common_values.size()));
+
+    // When nearly all sampled values are distinct, the column is likely unique:
+    // the number of distinct values grows with the number of rows.
+    if (sampled_fraction < 1.0 && double(count_distinct) >= 0.9 * double(this->_values.size()))
+    {
+        count_distinct = static_cast<std::uint64_t>(double(count_distinct) / sampled_fraction);
+    }
+
+    return ColumnStatistic{null_fraction,
+                           std::max<std::uint64_t>(1u, count_distinct),
+                           this->_values.front(),
+                           this->_values.back(),
+                           std::move(most_common_values),
+                           EquiDepthHistogram::build(this->_values, count_buckets)};
+}
@@ -0,0 +1,108 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <statistic/histogram.h>
+
+using namespace beedb::statistic;
+
+EquiDepthHistogram EquiDepthHistogram::build(const std::vector<double> &sorted_values, const std::size_t count_buckets)
+{
+    if (sorted_values.empty() || count_buckets == 0u)
+    {
+        return EquiDepthHistogram{};
+    }
+
+    const auto buckets = std::min(count_buckets, sorted_values.size());
+    const auto last_index = sorted_values.size() - 1u;
+
+    std::vector<double> bounds;
+    bounds.reserve(buckets + 1u);
+    for (auto i = 0u; i <= buckets; ++i)
+    {
+        bounds.push_back(sorted_values[(i * last_index) / buckets]);
+    }
+
+    return EquiDepthHistogram{std::move(bounds)};
+}
+
+EquiDepthHistogram EquiDepthHistogram::from_string(const std::string &serialized)
+{
+    std::vector<double> bounds;
+    std::stringstream stream{serialized};
+    std::string bound;
+    while (std::getline(stream, bound, ';'))
+    {
+        if (bound.empty() == false)
+        {
+            bounds.push_back(std::stod(bound));
+        }
+    }
+
+    return EquiDepthHistogram{std::move(bounds)};
+}
+
+std::string EquiDepthHistogram::to_string() const
+{
+    std::stringstream stream;
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (auto i = 0u; i < this->_bounds.size(); ++i)
+    {
+        if (i > 0u)
+        {
+            stream << ';';
+        }
+        stream << this->_bounds[i];
+    }
+
+    return stream.str();
+}
+
+double EquiDepthHistogram::fraction_lesser(const double value) const
+{
+    if (this->empty() || value <= this->_bounds.front())
+    {
+        return 0.0;
+    }
+
+    if (value > this->_bounds.back())
+    {
+        return 1.0;
+    }
+
+    // First bound that is not lesser than the value; the value
+    // is located in the bucket ending at this bound.
+    const auto upper = std::lower_bound(this->_bounds.begin(), this->_bounds.end(), value);
+    const auto bucket = static_cast<std::size_t>(std::distance(this->_bounds.begin(), upper)) - 1u;
+    const auto lower_bound = this->_bounds[bucket];
+    const auto upper_bound = this->_bounds[bucket + 1u];
+
+    auto within_bucket = 0.0;
+    if (upper_bound > lower_bound)
+    {
+        within_bucket = (value - lower_bound) / (upper_bound - lower_bound);
+    }
+
+    return (double(bucket) + within_bucket) / double(this->count_buckets());
+}
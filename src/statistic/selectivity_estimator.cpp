@@ -0,0 +1,217 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <statistic/selectivity_estimator.h>
+
+using namespace beedb::statistic;
+
+double SelectivityEstimator::estimate(const std::unique_ptr<expression::Operation> &predicate) const
+{
+    if (predicate == nullptr)
+    {
+        return 1.0;
+    }
+
+    if (predicate->is_logical_connective())
+    {
+        auto *binary_operation = reinterpret_cast<expression::BinaryOperation *>(predicate.get());
+        const auto left = this->estimate(binary_operation->left_child());
+        const auto right = this->estimate(binary_operation->right_child());
+
+        if (predicate->type() == expression::Operation::Type::And)
+        {
+            return left * right;
+        }
+
+        return left + right - left * right;
+    }
+
+    if (predicate->is_comparison())
+    {
+        return std::clamp(this->estimate_comparison(reinterpret_cast<expression::BinaryOperation *>(predicate.get())),
+                          0.0, 1.0);
+    }
+
+    return 1.0;
+}
+
+std::uint64_t SelectivityEstimator::estimate_cardinality(const std::unique_ptr<expression::Operation> &predicate) const
+{
+    const auto cardinality = this->_statistics.table_statistics().cardinality(this->_table);
+    return static_cast<std::uint64_t>(std::llround(double(cardinality) * this->estimate(predicate)));
+}
+
+double SelectivityEstimator::estimate_comparison(const expression::BinaryOperation *comparison) const
+{
+    auto type = comparison->type();
+    if (comparison->left_child()->is_nullary() == false || comparison->right_child()->is_nullary() == false)
+    {
+        return type == expression::Operation::Type::Equals ? ColumnStatistic::default_equals_selectivity
+                                                           : ColumnStatistic::default_range_selectivity;
+    }
+
+    const auto &left = reinterpret_cast<expression::NullaryOperation *>(comparison->left_child().get())->term();
+    const auto &right = reinterpret_cast<expression::NullaryOperation *>(comparison->right_child().get())->term();
+    const auto left_index = this->column_index(left);
+    const auto right_index = this->column_index(right);
+
+    // Comparison of two columns (attribute = attribute).
+    if (left_index.has_value() && right_index.has_value())
+    {
+        if (type != expression::Operation::Type::Equals)
+        {
+            return ColumnStatistic::default_range_selectivity;
+        }
+
+        const auto left_statistic = this->_statistics.column_statistics().statistic(
+            this->_table.schema().column(left_index.value()).id());
+        const auto right_statistic = this->_statistics.column_statistics().statistic(
+            this->_table.schema().column(right_index.value()).id());
+        if (left_statistic.has_value() && right_statistic.has_value())
+        {
+            const auto distinct = std::max<std::uint64_t>(
+                1u, std::max(left_statistic->count_distinct(), right_statistic->count_distinct()));
+            return 1.0 / double(distinct);
+        }
+
+        return ColumnStatistic::default_equals_selectivity;
+    }
+
+    // Normalize to "attribute <op> value".
+    auto column = left_index;
+    const auto *value_term = &right;
+    if (column.has_value() == false && right_index.has_value())
+    {
+        column = right_index;
+        value_term = &left;
+        switch (type)
+        {
+        case expression::Operation::Type::Lesser:
+            type = expression::Operation::Type::Greater;
+            break;
+        case expression::Operation::Type::LesserEquals:
+            type = expression::Operation::Type::GreaterEquals;
+            break;
+        case expression::Operation::Type::Greater:
+            type = expression::Operation::Type::Lesser;
+            break;
+        case expression::Operation::Type::GreaterEquals:
+            type = expression::Operation::Type::LesserEquals;
+            break;
+        default:
+            break;
+        }
+    }
+
+    const auto statistic =
+        column.has_value()
+            ? this->_statistics.column_statistics().statistic(this->_table.schema().column(column.value()).id())
+            : std::nullopt;
+    const auto value =
+        column.has_value()
+            ? SelectivityEstimator::to_numeric(*value_term, this->_table.schema().column(column.value()).type())
+            : std::nullopt;
+
+    if (statistic.has_value() == false || value.has_value() == false)
+    {
+        switch (type)
+        {
+        case expression::Operation::Type::Equals:
+            return ColumnStatistic::default_equals_selectivity;
+        case expression::Operation::Type::NotEquals:
+            return 1.0 - ColumnStatistic::default_equals_selectivity;
+        default:
+            return ColumnStatistic::default_range_selectivity;
+        }
+    }
+
+    switch (type)
+    {
+    case expression::Operation::Type::Equals:
+        return statistic->selectivity_equals(value.value());
+    case expression::Operation::Type::NotEquals:
+        return (1.0 - statistic->null_fraction()) - statistic->selectivity_equals(value.value());
+    case expression::Operation::Type::Lesser:
+        return statistic->selectivity_lesser(value.value(), false);
+    case expression::Operation::Type::LesserEquals:
+        return statistic->selectivity_lesser(value.value(), true);
+    case expression::Operation::Type::Greater:
+        return statistic->selectivity_greater(value.value(), false);
+    case expression::Operation::Type::GreaterEquals:
+        return statistic->selectivity_greater(value.value(), true);
+    default:
+        return ColumnStatistic::default_range_selectivity;
+    }
+}
+
+std::optional<std::size_t> SelectivityEstimator::column_index(const expression::Term &term) const
+{
+    if (term.is_attribute() == false)
+    {
+        return std::nullopt;
+    }
+
+    const auto &attribute = term.get<expression::Attribute>();
+    if (attribute.table_name().has_value() && attribute.table_name().value() != this->_table.name() &&
+        attribute.table_name().value() != this->_table_alias)
+    {
+        return std::nullopt;
+    }
+
+    return this->_table.schema().column_index(attribute.column_name());
+}
+
+std::optional<double> SelectivityEstimator::to_numeric(const expression::Term &term, const table::Type type)
+{
+    const auto &value = term.attribute_or_value();
+    if (std::holds_alternative<std::int64_t>(value))
+    {
+        return double(std::get<std::int64_t>(value));
+    }
+    else if (std::holds_alternative<std::int32_t>(value))
+    {
+        return double(std::get<std::int32_t>(value));
+    }
+    else if (std::holds_alternative<double>(value))
+    {
+        return std::get<double>(value);
+    }
+    else if (std::holds_alternative<table::Date>(value))
+    {
+        return ColumnStatistic::to_numeric(table::Value{table::Type::make_date(), std::get<table::Date>(value)});
+    }
+    else if (std::holds_alternative<std::string>(value) || std::holds_alternative<std::string_view>(value))
+    {
+        const auto string = std::holds_alternative<std::string>(value) ? std::get<std::string>(value)
+                                                                       : std::string{std::get<std::string_view>(value)};
+        if (type == table::Type::DATE)
+        {
+            return ColumnStatistic::to_numeric(table::Value{type, table::Date::from_string(string)});
+        }
+
+        return ColumnStatistic::to_numeric(table::Value{table::Type::make_char(string.size()), string});
+    }
+
+    return std::nullopt;
+}
@@ -23,11 +23,13 @@
 #include <cassert>
 #include <config.h>
 #include <exception/disk_exception.h>
+#include <fcntl.h>
 #include <storage/manager.h>
+#include <unistd.h>
 
 using namespace beedb::storage;
 
-Manager::Manager(const std::string &file_name)
+Manager::Manager(const std::string &file_name) : _file_name(file_name)
 {
     this->_storage_file.open(file_name, std::ios::in | std::ios::out | std::ios::binary);
     if (this->_storage_file.is_open() == false)
@@ -51,6 +53,23 @@ Manager::~Manager()
     this->_storage_file.close();
 }
 
+void Manager::sync()
+{
+    this->_storage_file.flush();
+
+    // The stream does not expose its descriptor; syncing any descriptor syncs the file.
+    const auto file_descriptor = ::open(this->_file_name.c_str(), O_RDONLY);
+    if (file_descriptor < 0 || ::fsync(file_descriptor) != 0)
+    {
+        if (file_descriptor >= 0)
+        {
+            ::close(file_descriptor);
+        }
+        throw exception::CanNotOpenStorageFile(this->_file_name);
+    }
+    ::close(file_descriptor);
+}
+
 void Manager::read([[maybe_unused]] const Page::id_t page_id, [[maybe_unused]] std::byte *buffer)
 {
     /**
@@ -138,7 +157,8 @@ void Manager::write([[maybe_unused]] const Page::id_t page_id, [[maybe_unused]]
     // .write() expects a const char*, so we must reinterpret_cast the const std::byte* data.
     this->_storage_file.write(reinterpret_cast<const char*>(data), Config::page_size);
 
-    // It's crucial for a storage manager to ensure data is persistent.
-    // We flush the file stream to force the OS to write the buffer to disk.
+    // Hand the page over to the operating system, so it survives a crash of the process.
+    // The page is not synced: Committed changes are durable through the write-ahead log,
+    // data pages are forced to the disk by checkpoints only.
     this->_storage_file.flush();
 }
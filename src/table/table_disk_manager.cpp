@@ -26,7 +26,8 @@
 
 using namespace beedb::table;
 
-TableDiskManager::TableDiskManager(buffer::Manager &buffer_manager) : _buffer_manager(buffer_manager)
+TableDiskManager::TableDiskManager(buffer::Manager &buffer_manager, recovery::LogManager &log_manager)
+    : _buffer_manager(buffer_manager), _log_manager(log_manager)
 {
 }
 
@@ -59,6 +60,8 @@ std::pair<beedb::storage::RecordPage *, std::uint16_t> TableDiskManager::add_row
     const auto concurrency_metadata =
         concurrency::Metadata{storage::RecordIdentifier{page_id, slot_id}, transaction->begin_timestamp()};
     page->write(slot_id, &concurrency_metadata, tuple.data(), table.schema().row_size());
+    page->lsn(this->_log_manager.append(recovery::LogRecord::make_modification(
+        recovery::LogRecord::Type::Insert, transaction->begin_timestamp().time(), {page_id, slot_id}, {})));
 
     return std::make_pair(page, slot_id);
 }
@@ -150,6 +153,40 @@ void TableDiskManager::remove_row(Table &table, const storage::RecordIdentifier
     this->_buffer_manager.unpin(page, true);
 }
 
+void TableDiskManager::log_modification(concurrency::Transaction *transaction,
+                                        const concurrency::WriteSetItem &write_set_item)
+{
+    const auto record_identifier = write_set_item.in_place_record_identifier();
+
+    auto lsn = recovery::lsn_t{0u};
+    if (write_set_item == concurrency::WriteSetItem::Updated)
+    {
+        // The versioned record in the time travel space holds the before-image.
+        const auto old_record_identifier = write_set_item.old_version_record_identifier();
+        auto *time_travel_page =
+            reinterpret_cast<storage::RecordPage *>(this->_buffer_manager.pin(old_record_identifier.page_id()));
+        const auto &slot = time_travel_page->slot(old_record_identifier.slot());
+        lsn = this->_log_manager.append(recovery::LogRecord::make_modification(
+            recovery::LogRecord::Type::Update, transaction->begin_timestamp().time(), record_identifier,
+            old_record_identifier, (*time_travel_page)[slot.start()], slot.size()));
+        this->_buffer_manager.unpin(time_travel_page, false);
+    }
+    else if (write_set_item == concurrency::WriteSetItem::Deleted)
+    {
+        lsn = this->_log_manager.append(recovery::LogRecord::make_modification(
+            recovery::LogRecord::Type::Delete, transaction->begin_timestamp().time(), record_identifier, {}));
+    }
+    else
+    {
+        return;
+    }
+
+    // The modified page must not reach the disk before the log record.
+    auto *page = this->_buffer_manager.pin(record_identifier.page_id());
+    page->lsn(lsn);
+    this->_buffer_manager.unpin(page, true);
+}
+
 std::pair<beedb::storage::Page::id_t, std::uint16_t> TableDiskManager::find_page_for_row(Table &table,
                                                                                          const bool time_travel)
 {
@@ -196,7 +233,10 @@ std::pair<beedb::storage::Page::id_t, std::uint16_t> TableDiskManager::find_page
         {
             auto *new_page = this->_buffer_manager.allocate<storage::RecordPage>();
             page->next_page_id(new_page->id());
-            this->_buffer_manager.unpin(page, true);
+
+            // Links are not logged; write them through to keep the chain intact after a crash.
+            this->_buffer_manager.write_through(page);
+            this->_buffer_manager.unpin(page, false);
             table.last_page_id(new_page->id());
             page = reinterpret_cast<storage::RecordPage *>(new_page);
             break;
@@ -0,0 +1,160 @@
+/*------------------------------------------------------------------------------*
+ * Architecture & Implementation of DBMS                                        *
+ *------------------------------------------------------------------------------*
+ * Copyright 2022 Databases and Information Systems Group TU Dortmund           *
+ * Visit us at                                                                  *
+ *             http://dbis.cs.tu-dortmund.de/cms/en/home/                       *
+ *                                                                              *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS      *
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,  *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL      *
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR         *
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,        *
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR        *
+ * OTHER DEALINGS IN THE SOFTWARE.                                              *
+ *                                                                              *
+ * Authors:                                                                     *
+ *          Maximilian Berens   <maximilian.berens@tu-dortmund.de>              *
+ *          Roland Kühn         <roland.kuehn@cs.tu-dortmund.de>                *
+ *          Jan Mühlig          <jan.muehlig@tu-dortmund.de>                    *
+ *------------------------------------------------------------------------------*
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <util/block_compressor.h>
+
+using namespace beedb::util;
+
+bool BlockCompressor::compress(const std::byte *data, const std::size_t size, std::vector<std::byte> &compressed)
+{
+    const auto begin = compressed.size();
+
+    // Last position seen (+1) for every hashed sequence of 4 bytes.
+    std::array<std::uint32_t, 1u << hash_bits> positions{};
+
+    auto literals_begin = std::size_t(0u);
+    auto position = std::size_t(0u);
+    while (position + min_match_length <= size)
+    {
+        std::uint32_t sequence;
+        std::memcpy(&sequence, &data[position], sizeof(sequence));
+        const auto hash = (sequence * 2654435761u) >> (32u - hash_bits);
+        const auto candidate = std::size_t(positions[hash]);
+        positions[hash] = std::uint32_t(position + 1u);
+
+        if (candidate == 0u || position - (candidate - 1u) > max_offset ||
+            std::memcmp(&data[candidate - 1u], &data[position], min_match_length) != 0)
+        {
+            ++position;
+            continue;
+        }
+
+        const auto match = candidate - 1u;
+        auto match_length = std::size_t(min_match_length);
+        while (position + match_length < size && data[match + match_length] == data[position + match_length])
+        {
+            ++match_length;
+        }
+
+        // Sequence: token, literals, offset of the match.
+        const auto literals_length = position - literals_begin;
+        const auto token = (std::min<std::size_t>(literals_length, 15u) << 4u) |
+                           std::min<std::size_t>(match_length - min_match_length, 15u);
+        compressed.push_back(std::byte(token));
+        if (literals_length >= 15u)
+        {
+            BlockCompressor::write_length(literals_length - 15u, compressed);
+        }
+        compressed.insert(compressed.end(), &data[literals_begin], &data[position]);
+
+        const auto offset = std::uint16_t(position - match);
+        compressed.push_back(std::byte(offset & 0xFFu));
+        compressed.push_back(std::byte(offset >> 8u));
+        if (match_length - min_match_length >= 15u)
+        {
+            BlockCompressor::write_length(match_length - min_match_length - 15u, compressed);
+        }
+
+        position += match_length;
+        literals_begin = position;
+    }
+
+    // Last sequence: Remaining literals only.
+    const auto literals_length = size - literals_begin;
+    compressed.push_back(std::byte(std::min<std::size_t>(literals_length, 15u) << 4u));
+    if (literals_length >= 15u)
+    {
+        BlockCompressor::write_length(literals_length - 15u, compressed);
+    }
+    compressed.insert(compressed.end(), &data[literals_begin], &data[size]);
+
+    return compressed.size() - begin < size;
+}
+
+void BlockCompressor::decompress(const std::byte *compressed, const std::size_t compressed_size,
+                                 const std::size_t size, std::vector<std::byte> &data)
+{
+    const auto begin = data.size();
+    data.reserve(begin + size);
+
+    auto index = std::size_t(0u);
+    while (index < compressed_size)
+    {
+        const auto token = std::uint8_t(compressed[index++]);
+
+        auto literals_length = std::size_t(token >> 4u);
+        if (literals_length == 15u)
+        {
+            literals_length += BlockCompressor::read_length(compressed, index);
+        }
+        data.insert(data.end(), &compressed[index], &compressed[index + literals_length]);
+        index += literals_length;
+
+        if (data.size() - begin >= size)
+        {
+            return;
+        }
+
+        const auto offset = std::size_t(compressed[index]) | (std::size_t(compressed[index + 1u]) << 8u);
+        index += 2u;
+
+        auto match_length = std::size_t(token & 0xFu);
+        if (match_length == 15u)
+        {
+            match_length += BlockCompressor::read_length(compressed, index);
+        }
+        match_length += min_match_length;
+
+        // Matches may overlap the bytes they produce, so they are copied byte by byte.
+        const auto match = data.size() - offset;
+        for (auto i = 0u; i < match_length; ++i)
+        {
+            data.push_back(data[match + i]);
+        }
+    }
+}
+
+void BlockCompressor::write_length(std::size_t length, std::vector<std::byte> &compressed)
+{
+    while (length >= 255u)
+    {
+        compressed.push_back(std::byte(255u));
+        length -= 255u;
+    }
+    compressed.push_back(std::byte(length));
+}
+
+std::size_t BlockCompressor::read_length(const std::byte *compressed, std::size_t &index)
+{
+    auto length = std::size_t(0u);
+    std::uint8_t byte;
+    do
+    {
+        byte = std::uint8_t(compressed[index++]);
+        length += byte;
+    } while (byte == 255u);
+
+    return length;
+}
@@ -20,7 +20,7 @@
  *------------------------------------------------------------------------------*
  */
 
-#include "perf.h"
+#include <util/perf.h>
 
 using namespace beedb::util;
 
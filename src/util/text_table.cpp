@@ -103,6 +103,210 @@ std::size_t TextTable::printed_length(const std::string &input)
     return input.size() - ((input.size() - print_size) / 2);
 }
 
+std::optional<StreamingTextTable::Format> StreamingTextTable::format(const std::string &name)
+{
+    auto lower_name = name;
+    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(),
+                   [](const auto character) { return std::tolower(character); });
+
+    if (lower_name == "table")
+    {
+        return StreamingTextTable::Table;
+    }
+    else if (lower_name == "csv")
+    {
+        return StreamingTextTable::CSV;
+    }
+    else if (lower_name == "tsv")
+    {
+        return StreamingTextTable::TSV;
+    }
+
+    return std::nullopt;
+}
+
+void StreamingTextTable::header(std::vector<std::string> &&row_values, std::vector<std::size_t> &&column_lengths)
+{
+    this->clear();
+    this->_header = std::move(row_values);
+    this->_column_lengths.resize(this->_header.size(), 0u);
+
+    // Only tables need to know the widths before printing; without sample rows, they are given.
+    if (this->_format != StreamingTextTable::Table || this->_count_sample_rows == 0u)
+    {
+        if (column_lengths.size() == this->_header.size())
+        {
+            this->_column_lengths = std::move(column_lengths);
+        }
+        this->start();
+    }
+}
+
+void StreamingTextTable::push_back(std::vector<std::string> &&row_values)
+{
+    if (this->_is_printing)
+    {
+        this->print(row_values);
+    }
+    else
+    {
+        this->_sample_rows.emplace_back(std::move(row_values));
+        if (this->_sample_rows.size() >= this->_count_sample_rows)
+        {
+            this->start();
+        }
+    }
+}
+
+void StreamingTextTable::flush()
+{
+    if (this->_header.empty())
+    {
+        return;
+    }
+
+    if (this->_is_printing == false)
+    {
+        this->start();
+    }
+
+    if (this->_format == StreamingTextTable::Table)
+    {
+        TextTable::print_separator_line(this->_stream, this->_column_lengths, "└", "┘", "┴");
+    }
+
+    this->_stream << std::flush;
+    this->clear();
+}
+
+void StreamingTextTable::clear()
+{
+    this->_header.clear();
+    this->_sample_rows.clear();
+    this->_column_lengths.clear();
+    this->_is_printing = false;
+}
+
+void StreamingTextTable::start()
+{
+    if (this->_format == StreamingTextTable::Table)
+    {
+        for (auto i = 0u; i < this->_header.size(); ++i)
+        {
+            this->_column_lengths[i] = std::max(this->_column_lengths[i], TextTable::printed_length(this->_header[i]));
+        }
+
+        for (const auto &row : this->_sample_rows)
+        {
+            for (auto i = 0u; i < row.size() && i < this->_column_lengths.size(); ++i)
+            {
+                this->_column_lengths[i] = std::max(this->_column_lengths[i], TextTable::printed_length(row[i]));
+            }
+        }
+
+        TextTable::print_separator_line(this->_stream, this->_column_lengths, "┌", "┐", "┬");
+        this->print(this->_header);
+        TextTable::print_separator_line(this->_stream, this->_column_lengths, "├", "┤", "┼");
+    }
+    else
+    {
+        this->print(this->_header);
+    }
+
+    for (const auto &row : this->_sample_rows)
+    {
+        this->print(row);
+    }
+
+    this->_sample_rows.clear();
+    this->_is_printing = true;
+}
+
+void StreamingTextTable::print(const std::vector<std::string> &row)
+{
+    if (this->_format == StreamingTextTable::Table)
+    {
+        for (auto i = 0u; i < row.size(); ++i)
+        {
+            const auto &cell = row[i];
+            const auto length = TextTable::printed_length(cell);
+            const auto column_length = i < this->_column_lengths.size() ? this->_column_lengths[i] : 0u;
+            this->_stream << "│ " << cell << std::string(column_length > length ? column_length - length : 0u, ' ')
+                          << " ";
+        }
+        this->_stream << "│\n";
+    }
+    else
+    {
+        const auto separator = this->_format == StreamingTextTable::CSV ? ',' : '\t';
+        for (auto i = 0u; i < row.size(); ++i)
+        {
+            if (i > 0u)
+            {
+                this->_stream << separator;
+            }
+            this->_stream << (this->_format == StreamingTextTable::CSV ? StreamingTextTable::escape_csv(row[i])
+                                                                        : StreamingTextTable::escape_tsv(row[i]));
+        }
+        this->_stream << '\n';
+    }
+}
+
+std::string StreamingTextTable::escape_csv(const std::string &value)
+{
+    if (value.find_first_of(",\"\r\n") == std::string::npos)
+    {
+        return value;
+    }
+
+    auto escaped = std::string{"\""};
+    for (const auto character : value)
+    {
+        if (character == '"')
+        {
+            escaped += '"';
+        }
+        escaped += character;
+    }
+
+    return escaped + "\"";
+}
+
+std::string StreamingTextTable::escape_tsv(const std::string &value)
+{
+    if (value.find_first_of("\t\r\n\\") == std::string::npos)
+    {
+        return value;
+    }
+
+    auto escaped = std::string{};
+    for (const auto character : value)
+    {
+        if (character == '\t')
+        {
+            escaped += "\\t";
+        }
+        else if (character == '\r')
+        {
+            escaped += "\\r";
+        }
+        else if (character == '\n')
+        {
+            escaped += "\\n";
+        }
+        else if (character == '\\')
+        {
+            escaped += "\\\\";
+        }
+        else
+        {
+            escaped += character;
+        }
+    }
+
+    return escaped;
+}
+
 namespace beedb::util
 {
 std::ostream &operator<<(std::ostream &stream, const TextTable &text_table)